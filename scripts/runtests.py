@@ -261,6 +261,15 @@ def test(testdir):
                 print("  ├ {}{} (skipped - no {} executable){}".format(color.boldyellow,desc,exestr,color.reset))
                 skips += 1
                 continue
+            # Restart from a checkpoint written by an earlier section of this test,
+            # given as <section>/<checkpoint>, e.g. 2d-parallel-checkpoint/chk00250
+            if 'restart' in config[desc].keys():
+                chk = "{}/{}_{}".format(testdir,testid,config[desc]['restart'])
+                if not os.path.isdir(chk):
+                    print("  ├ {}{} (skipped - no checkpoint {}){}".format(color.boldyellow,desc,chk,color.reset))
+                    skips += 1
+                    continue
+                cmdargs += " restart_checkpoint={}".format(chk)
             command += exestr + " "
             command += "{}/input ".format(testdir)
             command += cmdargs
@@ -349,6 +358,8 @@ def test(testdir):
                 cmd = ["./test","{}_{}".format(testid,desc)]
                 if "check-file" in config[desc].keys():
                     cmd.append(config[desc]['check-file'])
+                if "check-tolerance" in config[desc].keys():
+                    cmd.append("tolerance={}".format(config[desc]['check-tolerance']))
                 if args.cmd: 
                     print("  ├      " + ' '.join(cmd))
                 p = subprocess.check_output(cmd,cwd=testdir,stderr=subprocess.PIPE)
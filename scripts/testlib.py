@@ -5,6 +5,12 @@ def integrate(x,y):
     for i in range(len(x)-1): ret = ret + 0.5*(y[i+1]+y[i]) * (x[i+1]-x[i])
     return ret
 
+def tolerance(default):
+    """Tolerance set with check-tolerance in the test input, or the default"""
+    for arg in sys.argv[2:]:
+        if arg.startswith("tolerance="): return float(arg.split("=",1)[1])
+    return default
+
 def readHeader(path):
     ret = dict()
     f = open(path+"/Header")
@@ -109,3 +115,46 @@ def validate(path,
     if not all_ok:
         print("ERROR: Regression test failed")
         raise(Exception("One or more errors out of tolerance or nan"))
+
+def compare(path,
+            refpath,
+            outdir,
+            vars = [],
+            start = [0,0,0],
+            end = [1,1,1],
+            tolerance=1E-8,
+            coord = 'x'):
+    """Compare the output in path to that of another run of the same test, in refpath,
+    along the ray from start to end, parameterized by coord ('x' or 'y')"""
+    ds = yt.load(path)
+    ref_ds = yt.load(refpath)
+    dim = int(ds.domain_dimensions[0] > 1) + int(ds.domain_dimensions[1] > 1) + int(ds.domain_dimensions[2] > 1)
+    if dim == 2:
+        start = start[:2] + [0.0]
+        end = end[:2] + [0.0]
+
+    new_df = ds.ray(start,end).to_dataframe([("gas",coord),*vars])
+    ref_df = ref_ds.ray(start,end).to_dataframe([("gas",coord),*vars])
+
+    all_ok = True
+    for var in vars:
+        new_x,new_var = [numpy.array(_x) for _x in zip(*sorted(zip(new_df[coord],new_df[var])))]
+        ref_x,ref_var = [numpy.array(_x) for _x in zip(*sorted(zip(ref_df[coord],ref_df[var])))]
+
+        pylab.clf()
+        pylab.plot(ref_x,ref_var,color='C0',label='ref')
+        pylab.plot(new_x,new_var,color='C1',label='new',linestyle='--')
+        pylab.legend()
+        pylab.savefig(outdir+("/{}.png" if coord == 'x' else "/{}_"+coord+".png").format(var))
+
+        err = numpy.sqrt(integrate(ref_x, (numpy.interp(ref_x, new_x, new_var) - ref_var)**2))
+        mag = numpy.sqrt(integrate(ref_x, (numpy.interp(ref_x, new_x, new_var) + ref_var)**2))
+        relerr = err/mag
+
+        print("{} rel error [tolerance={}]".format(var,tolerance),relerr)
+        if relerr > tolerance: all_ok = False
+        if math.isnan(relerr): all_ok = False
+
+    if not all_ok:
+        print("ERROR: Regression test failed")
+        raise(Exception("One or more errors out of tolerance or nan"))
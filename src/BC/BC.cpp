@@ -61,5 +61,17 @@ bool IsReflectOdd(int bctype)
     if (bctype == (int)amrex::BCType::mathematicalBndryTypes::reflect_odd) return true;
     else return false;
 }
+amrex::LinOpBCType ToLinOpBCType(int bctype)
+{
+    if (IsPeriodic(bctype))    return amrex::LinOpBCType::Periodic;
+    if (IsDirichlet(bctype))   return amrex::LinOpBCType::Dirichlet;
+    if (IsNeumann(bctype))     return amrex::LinOpBCType::Neumann;
+    if (IsReflectEven(bctype)) return amrex::LinOpBCType::Neumann;
+    if (IsReflectOdd(bctype))  return amrex::LinOpBCType::reflect_odd;
+    if (bctype == (int)amrex::LinOpBCType::reflect_odd) return amrex::LinOpBCType::reflect_odd;
+    if (bctype == (int)amrex::BCType::mathematicalBndryTypes::foextrap) return amrex::LinOpBCType::Neumann;
+    Util::Abort(INFO, "BC type ", bctype, " has no linear solver equivalent");
+    return amrex::LinOpBCType::bogus;
+}
 }
 }
@@ -199,5 +199,31 @@ amrex::Periodicity Constant::Periodicity (const amrex::Box& b) {
 
 }
 
+bool
+Constant::IsCopy() const
+{
+    for (int f = 0; f < m_nfaces; f++)
+        for (unsigned int n = 0; n < m_bc_type[f].size(); n++)
+        {
+            const int type = m_bc_type[f][n];
+            if (BCUtil::IsPeriodic(type) || BCUtil::IsReflectEven(type)) continue;
+            if (BCUtil::IsNeumann(type) && (n >= m_bc_val[f].size() || m_bc_val[f][n].IsZero())) continue;
+            return false;
+        }
+    return true;
+}
+
+std::array<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>, 2>
+Constant::LinOpBCTypes(int comp)
+{
+    std::array<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>, 2> ret;
+    for (int d = 0; d < AMREX_SPACEDIM; d++)
+    {
+        ret[0][d] = BCUtil::ToLinOpBCType(m_bc_type[d][comp]);
+        ret[1][d] = BCUtil::ToLinOpBCType(m_bc_type[d + AMREX_SPACEDIM][comp]);
+    }
+    return ret;
+}
+
 
 }
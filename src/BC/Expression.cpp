@@ -1,8 +1,28 @@
 #include "Expression.H"
 
+#include <AMReX_OpenMP.H>
+
 namespace BC
 {
 
+namespace
+{
+// Index (in BC::Orientation order) of the face that fills the ghost cell at
+// offset glevel from the domain, or -1 if the cell is not handled by this fill.
+// Faces are checked in the order xlo, xhi, ylo, yhi, zlo, zhi, so edges and corners
+// belong to the first face that claims them.
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+int ResponsibleFace(const amrex::IntVect& glevel, const Orientation face)
+{
+    for (int d = 0; d < AMREX_SPACEDIM; d++)
+    {
+        if (glevel[d] < 0 && (face == d || face == Orientation::All)) return d;
+        if (glevel[d] > 0 && (face == d + AMREX_SPACEDIM || face == Orientation::All)) return d + AMREX_SPACEDIM;
+    }
+    return -1;
+}
+}
+
 void
 Expression::FillBoundary (amrex::BaseFab<Set::Scalar> &a_in,
                         const amrex::Box &a_box,
@@ -21,114 +41,207 @@ Expression::FillBoundary (amrex::BaseFab<Set::Scalar> &a_in,
 
     amrex::IndexType type = amrex::IndexType::TheCellType();
 
+    // Only cells outside the domain are affected, so loop over those alone
+    amrex::BoxList ghosts = amrex::boxDiff(amrex::Box(box.smallEnd(), box.bigEnd()), m_geom.Domain());
+    if (ghosts.isEmpty()) return;
+
     for (int n = 0; n < a_in.nComp(); n++)
-    amrex::ParallelFor (box,[=] AMREX_GPU_DEVICE(int i, int j, int k)
     {
-        Set::Vector pos = Set::Position(i, j, k, m_geom, type);
-        Set::Scalar x = 0.0, y=0.0, z=0.0, t=time;
-        x = pos(0);
-        #if AMREX_SPACEDIM > 1
-        y = pos(1);
-        #if AMREX_SPACEDIM > 2
-        z = pos(2);
-        #endif
-        #endif
-
-
-        amrex::IntVect glevel;
-        AMREX_D_TERM(glevel[0] = std::max(std::min(0,i-lo.x),i-hi.x); ,
-                    glevel[1] = std::max(std::min(0,j-lo.y),j-hi.y); ,
-                    glevel[2] = std::max(std::min(0,k-lo.z),k-hi.z); );
-        
-        if (glevel[0]<0 && (face == Orientation::xlo || face == Orientation::All)) // Left boundary
+        amrex::GpuArray<int, m_nfaces> bctype;
+        amrex::GpuArray<Numeric::Expression::Evaluator, m_nfaces> func;
+        bool general = false, timedependent = false;
+        for (int f = 0; f < m_nfaces; f++)
         {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::XLO][n]))
-                in(i,j,k,n) = m_bc_func[Face::XLO][n](x,y,z,t);
-            else if(BCUtil::IsNeumann(m_bc_type[Face::XLO][n]))
-                in(i,j,k,n) = in(i-glevel[0],j,k,n) - (m_bc_func[Face::XLO].size() > 0 ? m_bc_func[Face::XLO][n](x,y,z,t)*DX[0] : 0);
-            else if(BCUtil::IsReflectEven(m_bc_type[Face::XLO][n]))
-                in(i,j,k,n) = in(1-glevel[0],j,k,n);
-            else if(BCUtil::IsReflectOdd(m_bc_type[Face::XLO][n]))
-                in(i,j,k,n) = -in(1-glevel[0],j,k,n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::XLO][n])) {}
-            else
-                Util::Abort(INFO, "Incorrect boundary conditions");
+            bctype[f] = m_bc_type[f][n];
+            func[f] = m_bc_func[f][n].At(time);
+            if (func[f].kind == Numeric::Expression::Kind::General &&
+                (BCUtil::IsDirichlet(bctype[f]) || BCUtil::IsNeumann(bctype[f])))
+            {
+                general = true;
+                timedependent = timedependent || m_bc_func[f][n].DependsOnTime();
+            }
         }
-        else if (glevel[0]>0 && (face == Orientation::xhi || face == Orientation::All)) // Right boundary
-        {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::XHI][n]))
-                in(i,j,k,n) = m_bc_func[Face::XHI][n](x,y,z,t);
-            else if(BCUtil::IsNeumann(m_bc_type[Face::XHI][n]))
-                in(i,j,k,n) = in(i-glevel[0],j,k,n) - (m_bc_func[Face::XHI].size() > 0 ? m_bc_func[Face::XHI][n](x,y,z,t)*DX[0] : 0);
-            else if(BCUtil::IsReflectEven(m_bc_type[Face::XHI][n]))
-                in(i,j,k,n) = in(hi.x-glevel[0],j,k,n);
-            else if(BCUtil::IsReflectOdd(m_bc_type[Face::XHI][n]))
-                in(i,j,k,n) = -in(hi.x-glevel[0],j,k,n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::XHI][n])) {}
-            else
-                Util::Abort(INFO, "Incorrect boundary conditions");
-        }
-        
-        else if (glevel[1]<0 && (face == Orientation::ylo || face == Orientation::All)) // Bottom boundary
+        // The map is shared by all threads, so fills from inside a parallel region
+        // evaluate their expressions directly
+        const bool usecache = general && m_cache && !amrex::OpenMP::in_parallel();
+
+        // Entries for grids that no longer exist are dropped all at once, before
+        // this fill reads any of them and after earlier fills are done with them
+        if (usecache && m_cache_entries.size() + ghosts.size() > m_cache_max)
         {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::YLO][n]))
-                in(i,j,k,n) = m_bc_func[Face::YLO][n](x,y,z,t);
-            else if (BCUtil::IsNeumann(m_bc_type[Face::YLO][n]))
-                in(i,j,k,n) = in(i,j-glevel[1],k,n) - (m_bc_func[Face::YLO].size() > 0 ? m_bc_func[Face::YLO][n](x,y,z,t)*DX[1] : 0);
-            else if (BCUtil::IsReflectEven(m_bc_type[Face::YLO][n]))
-                in(i,j,k,n) = in(i,j-glevel[1],k,n);
-            else if (BCUtil::IsReflectOdd(m_bc_type[Face::YLO][n]))
-                in(i,j,k,n) = -in(i,j-glevel[1],k,n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::YLO][n])) {}
-            else
-                Util::Abort(INFO, "Incorrect boundary conditions");
+            amrex::Gpu::streamSynchronizeAll();
+            m_cache_entries.clear();
         }
-        else if (glevel[1]>0 && (face == Orientation::yhi || face == Orientation::All)) // Top boundary
+
+        bool synchronized = false;
+        for (const amrex::Box& ghost : ghosts)
         {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::YHI][n]))
-                in(i,j,k,n) = m_bc_func[Face::YHI][n](x,y,z,t);
-            else if (BCUtil::IsNeumann(m_bc_type[Face::YHI][n]))
-                in(i,j,k,n) = in(i,j-glevel[1],k,n) - (m_bc_func[Face::YHI].size() > 0 ? m_bc_func[Face::YHI][n](x,y,z,t)*DX[1] : 0);
-            else if (BCUtil::IsReflectEven(m_bc_type[Face::YHI][n]))
-                in(i,j,k,n) = in(i,hi.y-glevel[1],k,n);
-            else if (BCUtil::IsReflectOdd(m_bc_type[Face::YHI][n]))
-                in(i,j,k,n) = -in(i,hi.y-glevel[1],k,n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::YHI][n])) {}
-            else
-                Util::Abort(INFO, "Incorrect boundary conditions");
-        }
+            amrex::Array4<const Set::Scalar> cache;
+            if (usecache) cache = Cached(ghost, n, face, time, timedependent, func, bctype, synchronized);
+            const bool cached = (cache.p != nullptr);
+
+            amrex::ParallelFor (ghost,[=] AMREX_GPU_DEVICE(int i, int j, int k)
+            {
+                amrex::IntVect glevel;
+                AMREX_D_TERM(glevel[0] = std::max(std::min(0,i-lo.x),i-hi.x); ,
+                            glevel[1] = std::max(std::min(0,j-lo.y),j-hi.y); ,
+                            glevel[2] = std::max(std::min(0,k-lo.z),k-hi.z); );
 
+                const int f = ResponsibleFace(glevel, face);
+                if (f < 0) return;
+
+                Set::Scalar val = 0.0;
+                if (BCUtil::IsDirichlet(bctype[f]) || BCUtil::IsNeumann(bctype[f]))
+                {
+                    if (cached) val = cache(i,j,k);
+                    else
+                    {
+                        Set::Vector pos = Set::Position(i, j, k, m_geom, type);
+                        val = func[f](AMREX_D_PICK(pos(0),pos(0),pos(0)), AMREX_D_PICK(0.0,pos(1),pos(1)), AMREX_D_PICK(0.0,0.0,pos(2)), time);
+                    }
+                }
+
+                if (f == Face::XLO) // Left boundary
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if(BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i-glevel[0],j,k,n) - val*DX[0];
+                    else if(BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(1-glevel[0],j,k,n);
+                    else if(BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(1-glevel[0],j,k,n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else
+                        Util::Abort(INFO, "Incorrect boundary conditions");
+                }
+                else if (f == Face::XHI) // Right boundary
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if(BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i-glevel[0],j,k,n) - val*DX[0];
+                    else if(BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(hi.x-glevel[0],j,k,n);
+                    else if(BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(hi.x-glevel[0],j,k,n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else
+                        Util::Abort(INFO, "Incorrect boundary conditions");
+                }
+                else if (f == Face::YLO) // Bottom boundary
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if (BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i,j-glevel[1],k,n) - val*DX[1];
+                    else if (BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(i,j-glevel[1],k,n);
+                    else if (BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(i,j-glevel[1],k,n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else
+                        Util::Abort(INFO, "Incorrect boundary conditions");
+                }
+                else if (f == Face::YHI) // Top boundary
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if (BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i,j-glevel[1],k,n) - val*DX[1];
+                    else if (BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(i,hi.y-glevel[1],k,n);
+                    else if (BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(i,hi.y-glevel[1],k,n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else
+                        Util::Abort(INFO, "Incorrect boundary conditions");
+                }
 #if AMREX_SPACEDIM>2
-        else if (glevel[2]<0 && (face == Orientation::zlo || face == Orientation::All))
-        {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::ZLO][n]))
-                in(i,j,k,n) = m_bc_func[Face::ZLO][n](x,y,z,t);
-            else if (BCUtil::IsNeumann(m_bc_type[Face::ZLO][n]))
-                in(i,j,k,n) = in(i,j,k-glevel[2],n) - (m_bc_func[Face::ZLO].size() > 0 ? m_bc_func[Face::ZLO][n](x,y,z,t)*DX[2] : 0);
-            else if (BCUtil::IsReflectEven(m_bc_type[Face::ZLO][n]))
-                in(i,j,k,n) = in(i,j,1-glevel[2],n);
-            else if (BCUtil::IsReflectOdd(m_bc_type[Face::ZLO][n]))
-                in(i,j,k,n) = -in(i,j,1-glevel[2],n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::ZLO][n])) {}
-            else Util::Abort(INFO, "Incorrect boundary conditions");
-        }
-        else if (glevel[2]>0 && (face == Orientation::zhi || face == Orientation::All))
-        {
-            if (BCUtil::IsDirichlet(m_bc_type[Face::ZHI][n]))
-                in(i,j,k,n) = m_bc_func[Face::ZHI][n](x,y,z,t);
-            else if(BCUtil::IsNeumann(m_bc_type[Face::ZHI][n]))
-                in(i,j,k,n) = in(i,j,k-glevel[2],n) - (m_bc_func[Face::ZHI].size() > 0 ? m_bc_func[Face::ZHI][n](x,y,z,t)*DX[2] : 0);
-            else if(BCUtil::IsReflectEven(m_bc_type[Face::ZHI][n]))
-                in(i,j,k,n) = in(i,j,hi.z-glevel[2],n);
-            else if(BCUtil::IsReflectOdd(m_bc_type[Face::ZHI][n]))
-                in(i,j,k,n) = -in(i,j,hi.z-glevel[2],n);
-            else if(BCUtil::IsPeriodic(m_bc_type[Face::ZHI][n])) {}
-            else Util::Abort(INFO, "Incorrect boundary conditions");
-        }
+                else if (f == Face::ZLO)
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if (BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i,j,k-glevel[2],n) - val*DX[2];
+                    else if (BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(i,j,1-glevel[2],n);
+                    else if (BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(i,j,1-glevel[2],n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else Util::Abort(INFO, "Incorrect boundary conditions");
+                }
+                else if (f == Face::ZHI)
+                {
+                    if (BCUtil::IsDirichlet(bctype[f]))
+                        in(i,j,k,n) = val;
+                    else if(BCUtil::IsNeumann(bctype[f]))
+                        in(i,j,k,n) = in(i,j,k-glevel[2],n) - val*DX[2];
+                    else if(BCUtil::IsReflectEven(bctype[f]))
+                        in(i,j,k,n) = in(i,j,hi.z-glevel[2],n);
+                    else if(BCUtil::IsReflectOdd(bctype[f]))
+                        in(i,j,k,n) = -in(i,j,hi.z-glevel[2],n);
+                    else if(BCUtil::IsPeriodic(bctype[f])) {}
+                    else Util::Abort(INFO, "Incorrect boundary conditions");
+                }
 #endif
+            });
+        }
+    }
+}
+
+amrex::Array4<const Set::Scalar>
+Expression::Cached (const amrex::Box &a_ghost, int a_n, Orientation a_face, Set::Scalar a_time, bool a_timedependent,
+                    const amrex::GpuArray<Numeric::Expression::Evaluator, m_nfaces> &a_func,
+                    const amrex::GpuArray<int, m_nfaces> &a_bctype, bool &a_synchronized)
+{
+    // The domain identifies the level; the ghost region identifies the patch and face
+    std::array<int, 4 * AMREX_SPACEDIM + 2> key;
+    for (int d = 0; d < AMREX_SPACEDIM; d++)
+    {
+        key[d]                      = m_geom.Domain().smallEnd(d);
+        key[d + AMREX_SPACEDIM]     = m_geom.Domain().bigEnd(d);
+        key[d + 2 * AMREX_SPACEDIM] = a_ghost.smallEnd(d);
+        key[d + 3 * AMREX_SPACEDIM] = a_ghost.bigEnd(d);
+    }
+    key[4 * AMREX_SPACEDIM]     = a_n;
+    key[4 * AMREX_SPACEDIM + 1] = (int)a_face;
+
+    auto it = m_cache_entries.find(key);
+    if (it != m_cache_entries.end() && (!a_timedependent || it->second.time == a_time))
+        return it->second.val.const_array();
 
+    // An outdated entry is overwritten in place (the key fixes its box), which must
+    // wait for the kernels of earlier fills that may still be reading it. New
+    // entries do not move existing ones, so the arrays already returned by this
+    // fill stay valid.
+    if (it != m_cache_entries.end() && !a_synchronized)
+    {
+        amrex::Gpu::streamSynchronizeAll();
+        a_synchronized = true;
+    }
+
+    CacheEntry& entry = (it != m_cache_entries.end()) ? it->second : m_cache_entries[key];
+    entry.time = a_time;
+    if (!entry.val.isAllocated()) entry.val.resize(a_ghost, 1);
 
+    const amrex::Dim3 lo= amrex::lbound(m_geom.Domain()), hi = amrex::ubound(m_geom.Domain());
+    amrex::Array4<Set::Scalar> const& val = entry.val.array();
+    amrex::IndexType type = amrex::IndexType::TheCellType();
+    amrex::ParallelFor (a_ghost,[=] AMREX_GPU_DEVICE(int i, int j, int k)
+    {
+        amrex::IntVect glevel;
+        AMREX_D_TERM(glevel[0] = std::max(std::min(0,i-lo.x),i-hi.x); ,
+                    glevel[1] = std::max(std::min(0,j-lo.y),j-hi.y); ,
+                    glevel[2] = std::max(std::min(0,k-lo.z),k-hi.z); );
+        const int f = ResponsibleFace(glevel, a_face);
+        val(i,j,k) = 0.0;
+        if (f < 0) return;
+        if (!BCUtil::IsDirichlet(a_bctype[f]) && !BCUtil::IsNeumann(a_bctype[f])) return;
+        Set::Vector pos = Set::Position(i, j, k, m_geom, type);
+        val(i,j,k) = a_func[f](AMREX_D_PICK(pos(0),pos(0),pos(0)), AMREX_D_PICK(0.0,pos(1),pos(1)), AMREX_D_PICK(0.0,0.0,pos(2)), a_time);
     });
+    return entry.val.const_array();
 }
 
 amrex::BCRec
@@ -160,5 +273,17 @@ amrex::Periodicity Expression::Periodicity (const amrex::Box& b) {
 
 }
 
+std::array<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>, 2>
+Expression::LinOpBCTypes(int comp)
+{
+    std::array<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>, 2> ret;
+    for (int d = 0; d < AMREX_SPACEDIM; d++)
+    {
+        ret[0][d] = BCUtil::ToLinOpBCType(m_bc_type[d][comp]);
+        ret[1][d] = BCUtil::ToLinOpBCType(m_bc_type[d + AMREX_SPACEDIM][comp]);
+    }
+    return ret;
+}
+
 
 }
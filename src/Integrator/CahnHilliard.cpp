@@ -41,40 +41,111 @@ CahnHilliard::TimeStepBegin(amrex::Real /*time*/, int /*iter*/)
 }
 
 void
-CahnHilliard::Advance (int lev, Set::Scalar /*time*/, Set::Scalar dt)
+CahnHilliard::Advance (int lev, Set::Scalar time, Set::Scalar dt)
 {
     std::swap(etaoldmf[lev], etanewmf[lev]);
+    if (method == "semi-implicit")
+    {
+        AdvanceSemiImplicit(lev, time, dt);
+        return;
+    }
     const amrex::Real* DX = geom[lev].CellSize();
+    const Set::Scalar gamma = this->gamma, L = this->L;
     for ( amrex::MFIter mfi(*etanewmf[lev],true); mfi.isValid(); ++mfi )
     {
         const amrex::Box& bx = mfi.tilebox();
         amrex::Array4<const amrex::Real> const& eta = etaoldmf[lev]->array(mfi);
         amrex::Array4<amrex::Real> const& inter    = intermediate[lev]->array(mfi);
-        amrex::Array4<amrex::Real> const& etanew    = etanewmf[lev]->array(mfi);
 
         amrex::ParallelFor (bx,[=] AMREX_GPU_DEVICE(int i, int j, int k){
-                                    Set::Scalar lap =
-                                        Numeric::Stencil<Set::Scalar,2,0,0>::D(eta,i,j,k,0,DX) +
-                                        Numeric::Stencil<Set::Scalar,2,0,0>::D(eta,i,j,k,0,DX);
-
                                     inter(i,j,k) =
                                         eta(i,j,k)*eta(i,j,k)*eta(i,j,k)
                                         - eta(i,j,k)
-                                        - gamma*lap;
+                                        - gamma*Numeric::Laplacian(eta,i,j,k,0,DX);
+                                });
+    }
 
+    // The second Laplacian reads the chemical potential in neighboring tiles and boxes
+    intermediate[lev]->FillBoundary(geom[lev].periodicity());
 
-                                    etanew(i,j,k) = eta(i,j,k) - dt*inter(i,j,k); // Allen Cahn
-                                });
+    for ( amrex::MFIter mfi(*etanewmf[lev],true); mfi.isValid(); ++mfi )
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<const amrex::Real> const& eta = etaoldmf[lev]->array(mfi);
+        amrex::Array4<const amrex::Real> const& inter = intermediate[lev]->array(mfi);
+        amrex::Array4<amrex::Real> const& etanew    = etanewmf[lev]->array(mfi);
 
         amrex::ParallelFor (bx,[=] AMREX_GPU_DEVICE(int i, int j, int k){
-                                    Set::Scalar lap = 
-                                        Numeric::Stencil<Set::Scalar,2,0,0>::D(inter,i,j,k,0,DX) +
-                                        Numeric::Stencil<Set::Scalar,2,0,0>::D(inter,i,j,k,0,DX);
-
-                                    etanew(i,j,k) = eta(i,j,k) + dt*lap;
+                                    etanew(i,j,k) = eta(i,j,k) + L*dt*Numeric::Laplacian(inter,i,j,k,0,DX);
                                 });
+    }
+}
 
+void
+CahnHilliard::AdvanceSemiImplicit (int lev, Set::Scalar /*time*/, Set::Scalar dt)
+{
+    const amrex::Real* DX = geom[lev].CellSize();
+    const amrex::Box& domain = geom[lev].Domain();
+    const Set::Scalar M = L;
+    const Set::Scalar S = std::max(semi_implicit.stabilization, 2.0 * std::sqrt(gamma / (M * dt)));
+
+    // (1 - a lap + b lap^2) = (1 - r1 lap)(1 - r2 lap)
+    const Set::Scalar a = dt * M * S, b = dt * M * gamma;
+    const Set::Scalar disc = std::sqrt(std::max(a * a - 4.0 * b, 0.0));
+    const Set::Scalar r1 = 0.5 * (a + disc), r2 = 0.5 * (a - disc);
+
+    // g = f'(eta) - S eta, with homogeneous Neumann (mirror) ghost cells on non-periodic faces
+    amrex::MultiFab g(grids[lev], dmap[lev], 1, 1);
+    for (amrex::MFIter mfi(g, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<const Set::Scalar> const& eta = etaoldmf[lev]->array(mfi);
+        amrex::Array4<Set::Scalar> const& gg = g.array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            gg(i,j,k) = eta(i,j,k)*eta(i,j,k)*eta(i,j,k) - eta(i,j,k) - S*eta(i,j,k);
+        });
     }
+    g.FillBoundary(geom[lev].periodicity());
+    for (amrex::MFIter mfi(g); mfi.isValid(); ++mfi)
+    {
+        amrex::Array4<Set::Scalar> const& gg = g.array(mfi);
+        for (int d = 0; d < AMREX_SPACEDIM; d++)
+        {
+            if (geom[lev].isPeriodic(d)) continue;
+            const int lo = domain.smallEnd(d), hi = domain.bigEnd(d);
+            amrex::ParallelFor(mfi.fabbox() & amrex::adjCellLo(domain, d, 1), [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                amrex::IntVect m(AMREX_D_DECL(i, j, k)); m[d] = lo;
+                gg(i,j,k) = gg(m);
+            });
+            amrex::ParallelFor(mfi.fabbox() & amrex::adjCellHi(domain, d, 1), [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                amrex::IntVect m(AMREX_D_DECL(i, j, k)); m[d] = hi;
+                gg(i,j,k) = gg(m);
+            });
+        }
+    }
+
+    // rhs = eta + dt M lap(g)
+    amrex::MultiFab rhs(grids[lev], dmap[lev], 1, 0);
+    for (amrex::MFIter mfi(rhs, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<const Set::Scalar> const& eta = etaoldmf[lev]->array(mfi);
+        amrex::Array4<const Set::Scalar> const& gg = g.const_array(mfi);
+        amrex::Array4<Set::Scalar> const& f = rhs.array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            f(i,j,k) = eta(i,j,k) + dt * M * Numeric::Laplacian(gg, i, j, k, 0, DX);
+        });
+    }
+
+    // Two Helmholtz solves, using the previous solution as the initial guess
+    amrex::MultiFab::Copy(*intermediate[lev], *etaoldmf[lev], 0, 0, ncomp, nghost);
+    amrex::MultiFab::Copy(*etanewmf[lev], *etaoldmf[lev], 0, 0, ncomp, nghost);
+    const int ref_ratio = lev > 0 ? refRatio(lev - 1)[0] : 2;
+    bc->define(geom[lev]);
+    semi_implicit.solver.Solve(lev, geom[lev], *bc, *intermediate[lev], rhs, 1.0, r1,
+                               lev > 0 ? intermediate[lev - 1].get() : nullptr, ref_ratio, 0);
+    semi_implicit.solver.Solve(lev, geom[lev], *bc, *etanewmf[lev], *intermediate[lev], 1.0, r2,
+                               lev > 0 ? etanewmf[lev - 1].get() : nullptr, ref_ratio, 1);
 }
 
 void
@@ -40,13 +40,17 @@ Flame::Parse(Flame& value, IO::ParmParse& pp)
         pp_query("pf.w12", value.pf.w12);  // Barrier energy
         pp_query("pf.w0", value.pf.w0);    // Burned rest energy
         pp_query("amr.ghost_cells", value.ghost_count); // number of ghost cells in all fields
+        pp_queryclass("pf.narrowband", value.narrowband); // Interface-local eta update, see :ref:`Numeric::NarrowBand`
+        if (value.narrowband.grow > value.ghost_count)
+            Util::Abort(INFO, "pf.narrowband.grow (", value.narrowband.grow, ") cannot exceed amr.ghost_cells (", value.ghost_count, ")");
         pp_query("geometry.x_len", value.x_len); // Domain x length
         pp_query("geometry.y_len", value.y_len); // Domain y length
 
         value.bc_eta = new BC::Constant(1);
         pp_queryclass("pf.eta.bc", *static_cast<BC::Constant*>(value.bc_eta)); // See :ref:`BC::Constant`
         value.RegisterNewFab(value.eta_mf, value.bc_eta, 1, value.ghost_count, "eta", true);
-        value.RegisterNewFab(value.eta_old_mf, value.bc_eta, 1, value.ghost_count, "eta_old", false);
+        // Swapped with eta before it is read, so its ghost cells are not filled by TimeStep
+        value.AddField<Set::Scalar, Set::Hypercube::Cell>(value.eta_old_mf, value.bc_eta, 1, value.ghost_count, "eta_old", false, false, true);
 
         std::string eta_bc_str = "constant";
         pp_query("pf.eta.ic.type", eta_bc_str); // Eta boundary condition [constant, expression]
@@ -295,9 +299,16 @@ void Flame::UpdateModel(int /*a_step*/, Set::Scalar /*a_time*/)
         eta_mf[lev]->FillBoundary();
         temp_mf[lev]->FillBoundary();
 
+        // The model only needs to be rebuilt in boxes where phi (or temperature) has changed
+        bool changed = true;
+        std::vector<const amrex::MultiFab*> model_fields = {phi_mf[lev].get()};
+        if (elastic.on) model_fields.push_back(temp_mf[lev].get());
+        const std::vector<bool> dirty = DirtyModel(lev, model_fields, changed);
+
         for (MFIter mfi(*model_mf[lev], false); mfi.isValid(); ++mfi)
         {
             amrex::Box bx = mfi.grownnodaltilebox() & domain;
+            const bool rebuild = dirty[mfi.LocalIndex()];
             //amrex::Box bx = mfi.nodaltilebox();
             //bx.grow(1);
             amrex::Array4<model_type>        const& model = model_mf[lev]->array(mfi);
@@ -309,13 +320,18 @@ void Flame::UpdateModel(int /*a_step*/, Set::Scalar /*a_time*/)
             if (elastic.on)
             {
                 amrex::Array4<const Set::Scalar> const& temp = temp_mf[lev]->array(mfi);
+                // The traction follows the burn front, so it is always recomputed
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+                {
+                    Set::Vector grad_eta = Numeric::CellGradientOnNode(eta, i, j, k, 0, DX);
+                    rhs(i, j, k) = elastic.traction * grad_eta;
+                });
+                if (!rebuild) continue;
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
                 {
                     //auto sten = Numeric::GetStencil(i, j, k, bx);
                     Set::Scalar phi_avg = phi(i, j, k, 0);
                     Set::Scalar temp_avg = Numeric::Interpolate::CellToNodeAverage(temp, i, j, k, 0);
-                    Set::Vector grad_eta = Numeric::CellGradientOnNode(eta, i, j, k, 0, DX);
-                    rhs(i, j, k) = elastic.traction * grad_eta;
 
                     model_type model_ap = elastic.model_ap;
                     model_ap.F0 -= Set::Matrix::Identity();
@@ -329,7 +345,7 @@ void Flame::UpdateModel(int /*a_step*/, Set::Scalar /*a_time*/)
                     model(i, j, k) = model_ap * phi_avg + model_htpb * (1. - phi_avg);
                 });
             }
-            else
+            else if (rebuild)
             {
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
                 {
@@ -343,7 +359,7 @@ void Flame::UpdateModel(int /*a_step*/, Set::Scalar /*a_time*/)
                 });
             }
         }
-        Util::RealFillBoundary(*model_mf[lev], geom[lev]);
+        if (changed) Util::RealFillBoundary(*model_mf[lev], geom[lev]);
 
         psi_mf[lev]->setVal(1.0);
         amrex::MultiFab::Copy(*psi_mf[lev], *eta_mf[lev], 0, 0, 1, psi_mf[lev]->nGrow());
@@ -363,6 +379,10 @@ void Flame::TimeStepBegin(Set::Scalar a_time, int a_iter)
 void Flame::TimeStepComplete(Set::Scalar /*a_time*/, int /*a_iter*/)
 {
     BL_PROFILE("Integrator::Flame::TimeStepComplete");
+    nan_flag.Check(INFO, {"etanew, alpha, or mdot contains nan",
+                          "heatflux contains nan",
+                          "temps or tempsnew contains nan",
+                          "mob contains nan"});
     if (variable_pressure) {
         Set::Scalar domain_area = x_len * y_len;
         chamber_pressure = pressure.P;
@@ -376,7 +396,14 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
 {
     BL_PROFILE("Integrador::Flame::Advance");
     Base::Mechanics<model_type>::Advance(lev, time, dt);
-    const Set::Scalar* DX = geom[lev].CellSize();
+    const Set::CellSize DX(geom[lev]);
+
+    // Kernels capture these copies rather than `this`
+    const auto pf = this->pf;
+    const auto thermal = this->thermal;
+    const int homogeneousSystem = this->homogeneousSystem;
+    const Set::Scalar small = this->small;
+    Util::ErrorFlag::Handle nan_flag = this->nan_flag.Device();
 
     if (true) //lev == finest_level) //(true)
     {
@@ -395,6 +422,7 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
 
             for (amrex::MFIter mfi(*eta_mf[lev], true); mfi.isValid(); ++mfi)
             {
+                Set::Scalar t0 = BoxCostTimer();
                 const amrex::Box& bx = mfi.tilebox();
                 // Phase fields
                 amrex::Array4<Set::Scalar> const& etanew = (*eta_mf[lev]).array(mfi);
@@ -424,6 +452,7 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                     elastic.traction = pressure.P;
 
                 }
+                const auto pressure = this->pressure;
 
                 Set::Scalar zeta_2 = 0.000045 - pressure.P * 6.42e-6;
                 Set::Scalar zeta_1;
@@ -435,10 +464,13 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                 Set::Scalar k3 = 4.0 * log((pressure.arrhenius.c1 * pressure.P * pressure.P + pressure.arrhenius.a3 * pressure.P + pressure.arrhenius.b3) - k1 / 2.0 - k2 / 2.0);
                 Set::Scalar k4 = pressure.arrhenius.h1 * pressure.P + pressure.arrhenius.h2;
 
+                // Away from the burn front eta is constant, so it is copied and
+                // temperature is only diffused.
+                const bool quiescent = narrowband.Quiescent(bx, eta, small, 1.0);
+
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
                 {
                     Set::Scalar phi_avg = Numeric::Interpolate::NodeToCellAverage(phi, i, j, k, 0);
-                    Set::Scalar eta_lap = Numeric::Laplacian(eta, i, j, k, 0, DX);
                     Set::Scalar K; // Calculate effective thermal conductivity
                     Set::Scalar rho; // No special interface mixure rule is needed here.
                     Set::Scalar cp;
@@ -452,19 +484,24 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                         rho = thermal.rho_ap * phi_avg + thermal.rho_htpb * (1.0 - phi_avg); // No special interface mixure rule is needed here.
                         cp = thermal.cp_ap * phi_avg + thermal.cp_htpb * (1.0 - phi_avg);
                     }
-                    Set::Scalar df_deta = ((pf.lambda / pf.eps) * dw(eta(i, j, k)) - pf.eps * pf.kappa * eta_lap);
-                    etanew(i, j, k) = eta(i, j, k) - mob(i, j, k) * dt * df_deta;
-                    if (etanew(i, j, k) <= small) etanew(i, j, k) = small;
-
                     alpha(i, j, k) = K / rho / cp; // Calculate thermal diffusivity and store in fiel
-                    mdot(i, j, k) = rho * fabs(eta(i, j, k) - etanew(i, j, k)) / dt; // deta/dt  
 
-                    if (isnan(etanew(i, j, k)) || isnan(alpha(i, j, k)) || isnan(mdot(i, j, k))) {
-                        Util::Message(INFO, etanew(i, j, k), "etanew contains nan (i=", i, " j= ", j, ")");
-                        Util::Message(INFO, mdot(i, j, k), "mdot contains nan (i=", i, " j= ", j, ")");
-                        Util::Message(INFO, alpha(i, j, k), "alpha contains nan (i=", i, " j= ", j, ")");
-                        Util::Abort(INFO);
+                    if (quiescent)
+                    {
+                        etanew(i, j, k) = eta(i, j, k);
+                        mdot(i, j, k) = 0.0;
+                    }
+                    else
+                    {
+                        Set::Scalar eta_lap = Numeric::Laplacian(eta, i, j, k, 0, DX);
+                        Set::Scalar df_deta = ((pf.lambda / pf.eps) * dw(eta(i, j, k)) - pf.eps * pf.kappa * eta_lap);
+                        etanew(i, j, k) = eta(i, j, k) - mob(i, j, k) * dt * df_deta;
+                        if (etanew(i, j, k) <= small) etanew(i, j, k) = small;
+                        mdot(i, j, k) = rho * fabs(eta(i, j, k) - etanew(i, j, k)) / dt; // deta/dt  
                     }
+
+                    if (isnan(etanew(i, j, k)) || isnan(alpha(i, j, k)) || isnan(mdot(i, j, k)))
+                        nan_flag.Raise(1, i, j, k);
                 });
 
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
@@ -497,34 +534,32 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                         heatflux(i, j, k) = (thermal.hc * mbase * qflux + laser(i, j, k)) / K;
                     }
 
-                    if (isnan(heatflux(i, j, k))) {
-                        Util::Message(INFO, heatflux(i, j, k), "heat contains nan (i=", i, " j= ", j, ")");
-                        Util::Abort(INFO);
-                    }
+                    if (isnan(heatflux(i, j, k)))
+                        nan_flag.Raise(2, i, j, k);
                 });
 
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
                 {
                     auto sten = Numeric::GetStencil(i, j, k, bx);
-                    Set::Vector grad_eta = Numeric::Gradient(eta, i, j, k, 0, DX);
                     Set::Vector grad_temp = Numeric::Gradient(temp, i, j, k, 0, DX);
                     Set::Scalar lap_temp = Numeric::Laplacian(temp, i, j, k, 0, DX);
-                    Set::Scalar grad_eta_mag = grad_eta.lpNorm<2>();
                     Set::Vector grad_alpha = Numeric::Gradient(alpha, i, j, k, 0, DX, sten);
                     Set::Scalar dTdt = 0.0;
-                    dTdt += grad_eta.dot(grad_temp * alpha(i, j, k));
+                    if (!quiescent)
+                    {
+                        Set::Vector grad_eta = Numeric::Gradient(eta, i, j, k, 0, DX);
+                        Set::Scalar grad_eta_mag = grad_eta.lpNorm<2>();
+                        dTdt += grad_eta.dot(grad_temp * alpha(i, j, k));
+                        dTdt += alpha(i, j, k) * heatflux(i, j, k) * grad_eta_mag;
+                    }
                     dTdt += grad_alpha.dot(eta(i, j, k) * grad_temp);
                     dTdt += eta(i, j, k) * alpha(i, j, k) * lap_temp;
-                    dTdt += alpha(i, j, k) * heatflux(i, j, k) * grad_eta_mag;
                     Set::Scalar Tsolid;
                     Tsolid = dTdt + temps(i, j, k) * (etanew(i, j, k) - eta(i, j, k)) / dt;
                     tempsnew(i, j, k) = temps(i, j, k) + dt * Tsolid;
                     tempnew(i, j, k) = etanew(i, j, k) * tempsnew(i, j, k) + (1.0 - etanew(i, j, k)) * thermal.T_fluid;
-                    if (isnan(tempsnew(i, j, k)) || isnan(temps(i, j, k))) {
-                        Util::Message(INFO, tempsnew(i, j, k), "tempsnew contains nan (i=", i, " j= ", j, ")");
-                        Util::Message(INFO, temps(i, j, k), "temps contains nan (i=", i, " j= ", j, ")");
-                        Util::Abort(INFO);
-                    }
+                    if (isnan(tempsnew(i, j, k)) || isnan(temps(i, j, k)))
+                        nan_flag.Raise(3, i, j, k);
 
                 });
 
@@ -541,13 +576,22 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                     if (tempnew(i, j, k) <= thermal.bound) mob(i, j, k) = 0;
                     else mob(i, j, k) = L;
                     //mob(i,j,k) = L;
-                    if (isnan(mob(i, j, k))) {
-                        Util::Message(INFO, mob(i, j, k), "mob contains nan (i=", i, " j= ", j, ")");
-                        Util::Abort(INFO);
-                    }
+                    if (isnan(mob(i, j, k)))
+                        nan_flag.Raise(4, i, j, k);
                 });
+                AddBoxCost(lev, mfi, BoxCostTimer() - t0);
             } // MFi For loop 
 
+            if (AdaptiveTimestep())
+            {
+                // Explicit limits from thermal diffusion and from the eta mobility
+                Set::Scalar dxmin = AMREX_D_PICK(DX[0], std::min(DX[0], DX[1]), std::min(DX[0], std::min(DX[1], DX[2])));
+                Set::Scalar alpha_max = alpha_mf[lev]->max(0, 0, true);
+                Set::Scalar mob_max = mob_mf[lev]->max(0, 0, true) * pf.eps * pf.kappa;
+                Set::Scalar diffusivity = std::max(alpha_max, mob_max);
+                if (diffusivity > 0.0) ReportStableTimestep(lev, dxmin * dxmin / (2.0 * AMREX_SPACEDIM * diffusivity));
+            }
+
         } // thermal IF
         else
         {
@@ -562,6 +606,7 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
 
             for (amrex::MFIter mfi(*eta_mf[lev], true); mfi.isValid(); ++mfi)
             {
+                Set::Scalar t0 = BoxCostTimer();
                 const amrex::Box& bx = mfi.tilebox();
                 //Phase Fields
                 amrex::Array4<Set::Scalar> const& etanew = (*eta_mf[lev]).array(mfi);
@@ -575,7 +620,17 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
                 pressure.power.a_fit = -1.16582 * sin(pressure.P) - 0.681788 * cos(pressure.P) + 3.3563;
                 pressure.power.b_fit = -0.708225 * sin(pressure.P) + 0.548067 * cos(pressure.P) + 1.55985;
                 pressure.power.c_fit = -0.0130849 * sin(pressure.P) - 0.03597 * cos(pressure.P) + 0.00725694;
+                const auto pressure = this->pressure;
 
+                if (narrowband.Quiescent(bx, eta, small, 1.0))
+                {
+                    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+                    {
+                        etanew(i, j, k) = eta(i, j, k);
+                    });
+                    AddBoxCost(lev, mfi, BoxCostTimer() - t0);
+                    continue;
+                }
 
                 amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
                 {
@@ -602,6 +657,7 @@ void Flame::Advance(int lev, Set::Scalar time, Set::Scalar dt)
 
                     if (etanew(i, j, k) > eta(i, j, k)) etanew(i, j, k) = eta(i, j, k);
                 });
+                AddBoxCost(lev, mfi, BoxCostTimer() - t0);
             } // MFI For Loop 
         } // thermal ELSE      
     }// First IF
@@ -676,6 +732,7 @@ void Flame::Regrid(int lev, Set::Scalar time)
     //phi_mf[lev]->setVal(0.0);
     ic_phi->Initialize(lev, phi_mf, time);
     //ic_phicell->Initialize(lev, phi_mf, time);
+    Base::Mechanics<model_type>::Regrid(lev, time);
 }
 
 void Flame::Integrate(int amrlev, Set::Scalar /*time*/, int /*step*/,
@@ -687,29 +744,28 @@ void Flame::Integrate(int amrlev, Set::Scalar /*time*/, int /*step*/,
     amrex::Array4<amrex::Real> const& eta = (*eta_mf[amrlev]).array(mfi);
     amrex::Array4<amrex::Real> const& mdot = (*mdot_mf[amrlev]).array(mfi);
     if (variable_pressure) {
-        amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        ThermoSum<3>(box, {&volume, &area, &massflux},
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> amrex::GpuArray<Set::Scalar, 3>
         {
-            volume += eta(i, j, k, 0) * dv;
             Set::Vector grad = Numeric::Gradient(eta, i, j, k, 0, DX);
             Set::Scalar normgrad = grad.lpNorm<2>();
             Set::Scalar da = normgrad * dv;
-            area += da;
 
             Set::Vector mgrad = Numeric::Gradient(mdot, i, j, k, 0, DX);
             Set::Scalar mnormgrad = mgrad.lpNorm<2>();
             Set::Scalar dm = mnormgrad * dv;
-            massflux += dm;
 
+            return { eta(i, j, k, 0) * dv, da, dm };
         });
     }
     else {
-        amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        ThermoSum<2>(box, {&volume, &area},
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> amrex::GpuArray<Set::Scalar, 2>
         {
-            volume += eta(i, j, k, 0) * dv;
             Set::Vector grad = Numeric::Gradient(eta, i, j, k, 0, DX);
             Set::Scalar normgrad = grad.lpNorm<2>();
             Set::Scalar da = normgrad * dv;
-            area += da;
+            return { eta(i, j, k, 0) * dv, da };
         });
     }
     // time dependent pressure data from experimenta -> p = 0.0954521220950523 * exp(15.289993148880678 * t)
@@ -7,13 +7,59 @@
 #include "IO/FileNameParse.H"
 #include "IO/ParmParse.H"
 #include "Util/Util.H"
+#include "Numeric/Stencil.H"
 #include <numeric>
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <sys/resource.h>
+
+#include <AMReX_AsyncOut.H>
+#include <AMReX_OpenMP.H>
+
+#ifdef AMREX_USE_HDF5
+#include <AMReX_PlotFileUtilHDF5.H>
+#endif
 
 
 
 namespace Integrator
 {
 
+namespace
+{
+// Round components [a_comp, a_comp + a_ncomp) to a multiple of 2*a_tol
+void Quantize(amrex::MultiFab& a_mf, int a_comp, int a_ncomp, Set::Scalar a_tol)
+{
+    if (a_tol <= 0.0 || a_ncomp <= 0) return;
+    const Set::Scalar step = 2.0 * a_tol;
+    for (amrex::MFIter mfi(a_mf, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<Set::Scalar> const& data = a_mf.array(mfi);
+        amrex::ParallelFor(bx, a_ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+            data(i, j, k, a_comp + n) = std::round(data(i, j, k, a_comp + n) / step) * step;
+        });
+    }
+}
+
+// Value of a cell or node field at a cell center (nodal data is averaged)
+AMREX_FORCE_INLINE
+Set::Scalar CellValue(const amrex::Array4<const Set::Scalar>& a_data, int i, int j, int k, int a_comp, bool a_nodal)
+{
+    return a_nodal ? Numeric::Interpolate::NodeToCellAverage(a_data, i, j, k, a_comp) : a_data(i, j, k, a_comp);
+}
+
+// Reuse an existing staging buffer if its layout is unchanged
+void Stage(amrex::MultiFab& a_mf, const amrex::BoxArray& a_ba, const amrex::DistributionMapping& a_dm, int a_ncomp)
+{
+    if (a_mf.ok() && a_mf.nComp() == a_ncomp &&
+        a_mf.boxArray() == a_ba && a_mf.DistributionMap() == a_dm) return;
+    a_mf = amrex::MultiFab(a_ba, a_dm, a_ncomp, 0);
+}
+}
+
 Integrator::Integrator() : amrex::AmrCore()
 {
     BL_PROFILE("Integrator::Integrator()");
@@ -27,6 +73,9 @@ Integrator::Integrator() : amrex::AmrCore()
         pp_query("restart", restart_file_cell);       // Name of restart file to READ from
         pp_query("restart_cell", restart_file_cell);  // Name of cell-fab restart file to read from
         pp_query("restart_node", restart_file_node);  // Name of node-fab restart file to read from
+        pp_query("restart_checkpoint", restart_checkpoint); // Name of checkpoint directory to restart from
+        if (restart_checkpoint != "" && (restart_file_cell != "" || restart_file_node != ""))
+            Util::Abort(INFO, "restart_checkpoint cannot be combined with restart, restart_cell, or restart_node");
     }
     {
         // This allows the user to ignore certain arguments that
@@ -51,9 +100,14 @@ Integrator::Integrator() : amrex::AmrCore()
         IO::ParmParse pp("amr");
         pp_query("regrid_int", regrid_int);           // Regridding interval in step numbers
         pp_query("base_regrid_int", base_regrid_int); // Regridding interval based on coarse level only
+        pp_query("regrid_reuse", m_regrid.reuse);     // Copy boxes that are unchanged by a regrid, and skip derived fields (default: off)
+        pp_query("overlap", m_overlap.on);            // Overlap the base level ghost exchange with computation (default: off)
         pp_query("plot_int", plot_int);               // Interval (in timesteps) between plotfiles
         pp_query("plot_dt", plot_dt);                 // Interval (in simulation time) between plotfiles
         pp_query("plot_file", plot_file);             // Output file
+        pp_query("checkpoint_int", m_checkpoint.interval); // Interval (in timesteps) between checkpoints
+        pp_query("checkpoint_nfiles", m_checkpoint.nfiles); // Maximum number of data files per level in a checkpoint
+        Util::Assert(INFO, TEST(m_checkpoint.nfiles > 0));
 
         pp_query("cell.all", cell.all);                // Turn on to write all output in cell fabs (default: off)
         pp_query("cell.any", cell.any);                // Turn off to prevent any cell based output (default: on)
@@ -64,6 +118,30 @@ Integrator::Integrator() : amrex::AmrCore()
         Util::Assert(INFO, TEST(!(!node.any && node.all)));
 
         pp_query("max_plot_level", max_plot_level);    // Specify a maximum level of refinement for output files
+        pp_query("plot_async", m_plot.async);          // Write plotfile data with AMReX's AsyncOut (default: off)
+        if (m_plot.async && !amrex::AsyncOut::UseAsyncOut())
+        {
+            Util::Warning(INFO, "amr.plot_async requires amrex.async_out, which could not be enabled; writing plotfiles synchronously");
+            m_plot.async = false;
+        }
+
+        std::string plot_precision = "double";
+        pp_query_validate("plot_precision", plot_precision, {"double","single"}); // Precision of plotfile data
+        m_plot.single = (plot_precision == "single");
+        // The FAB format is a process-wide setting. Plotfiles are the only FAB
+        // output (checkpoints are written as raw bytes), so it is set once here
+        // rather than around each write.
+        amrex::FArrayBox::setFormat(m_plot.single ? amrex::FABio::FAB_NATIVE_32 : amrex::FABio::FAB_NATIVE);
+        // AsyncOut always writes the data in native (double) precision
+        if (m_plot.single && m_plot.async)
+            Util::Abort(INFO, "amr.plot_precision=single cannot be used with amr.plot_async");
+        std::string plot_format = "native";
+        pp_query_validate("plot_format", plot_format, {"native","hdf5"}); // Plotfile format (hdf5 cannot be used for restart)
+        m_plot.hdf5 = (plot_format == "hdf5");
+        pp_query("plot_compression", m_plot.compression); // HDF5 compression, e.g. ZFP_ACCURACY@1e-6 (hdf5 only)
+#ifndef AMREX_USE_HDF5
+        if (m_plot.hdf5) Util::Abort(INFO, "amr.plot_format=hdf5 requires AMReX to be compiled with HDF5");
+#endif
 
         IO::FileNameParse(plot_file);
 
@@ -87,6 +165,32 @@ Integrator::Integrator() : amrex::AmrCore()
             for (int lev = 1; lev <= maxLevel(); ++lev)
                 nsubsteps[lev] = MaxRefRatio(lev - 1);
     }
+    {
+        // Adaptive timestepping: integrators report their stable timestep
+        // with ReportStableTimestep, and dt is adjusted between steps.
+        IO::ParmParse pp("amr.adaptive_dt");
+        pp_query("on", m_adaptive.on);             // Turn on adaptive timestepping (default: off)
+        pp_query("cfl", m_adaptive.cfl);           // Safety factor on the reported stable timestep (0.9)
+        pp_query("growth", m_adaptive.growth);     // Maximum growth factor of dt per step (1.2)
+        pp_query("min", m_adaptive.min);           // Minimum allowed timestep on amrlev = 0
+        pp_query("max", m_adaptive.max);           // Maximum allowed timestep on amrlev = 0
+        pp_query("subcycle", m_adaptive.subcycle); // Also adapt the number of substeps on each level (default: off)
+        Util::Assert(INFO, TEST(m_adaptive.cfl > 0.0 && m_adaptive.growth >= 1.0));
+        Util::Assert(INFO, TEST(m_adaptive.min <= m_adaptive.max));
+        m_adaptive.estimate.resize(maxLevel() + 1, std::numeric_limits<Set::Scalar>::max());
+    }
+    {
+        // Load balancing based on the per-box cost reported by the integrator
+        // (see AddBoxCost). Boxes are redistributed on regrid, and optionally
+        // at a fixed interval without regridding.
+        IO::ParmParse pp("amr.loadbalance");
+        pp_query("on", m_loadbalance.on); // Turn on cost-based load balancing (default: off)
+        pp_query_validate("strategy", m_loadbalance.strategy, {"sfc","knapsack"}); // Distribution strategy
+        pp_query("int", m_loadbalance.interval); // Rebalance every this many timesteps (default: only on regrid)
+        pp_query("threshold", m_loadbalance.threshold); // Required improvement in efficiency to rebalance (1.1)
+        m_loadbalance.cost.resize(maxLevel() + 1);
+        m_loadbalance.cost_grids.resize(maxLevel() + 1);
+    }
     {
         // Information on how to generate thermodynamic
         // data (to show up in thermo.dat)
@@ -96,6 +200,90 @@ Integrator::Integrator() : amrex::AmrCore()
         pp_query("plot_int", thermo.plot_int);         // Interval (in timesteps) between writing
         pp_query("plot_dt", thermo.plot_dt);           // Interval (in simulation time) between writing
     }
+    {
+        // Per-step wall time breakdown (written to [plot_file]/telemetry.dat).
+        // Each row reports, per level, the time spent in FillPatch, Advance,
+        // regridding (not counting tagging) and tagging, and, for the whole step,
+        // the time in the solves reported by the integrator, rebalancing, thermo
+        // integration, extraction and output, along with the cell count per level,
+        // the memory high-water mark, and the memory held by the fields (FABs) of all ranks.
+        IO::ParmParse pp("amr.telemetry");
+        pp_query("on", m_telemetry.on); // Turn on telemetry (default: off)
+        pp_query("int", m_telemetry.interval); // Write a row every this many timesteps (1)
+        if (m_telemetry.interval < 1) Util::Abort(INFO, "amr.telemetry.int must be positive but is ", m_telemetry.interval);
+        m_telemetry.fillpatch.resize(maxLevel() + 1, 0.0);
+        m_telemetry.advance.resize(maxLevel() + 1, 0.0);
+        m_telemetry.regrid.resize(maxLevel() + 1, 0.0);
+        m_telemetry.tag.resize(maxLevel() + 1, 0.0);
+    }
+    {
+        // In-situ extraction of reduced data (written to [plot_file]/extract).
+        // This is much cheaper than writing full plotfiles when only probes,
+        // front positions, line-outs or distributions are needed.
+        IO::ParmParse pp("amr.extract");
+        pp_query("int", extract.interval); // Extraction interval (in timesteps)
+        pp_query("dt", extract.dt);        // Extraction interval (in simulation time)
+
+        std::vector<std::string> names;
+        pp_queryarr("probes", names); // Names of point probes (written to scalars.dat)
+        for (auto name : names)
+        {
+            Extraction e; e.name = name;
+            IO::ParmParse pp("amr.extract." + name);
+            pp_query_required("field", e.field); // Field to sample
+            pp_query_default("comp", e.comp, 0); // Field component
+            pp_queryarr("x", e.x);               // Probe location
+            extract.probes.push_back(e);
+        }
+        names.clear();
+        pp_queryarr("fronts", names); // Names of front trackers (written to scalars.dat)
+        for (auto name : names)
+        {
+            Extraction e; e.name = name;
+            IO::ParmParse pp("amr.extract." + name);
+            pp_query_required("field", e.field); // Field defining the front
+            pp_query_default("comp", e.comp, 0); // Field component
+            pp_query_default("value", e.value, 0.5); // The front is where field >= value
+            pp_query_default("dir", e.dir, 0); // Coordinate direction in which to track the front
+            std::string side;
+            pp_query_validate("side", side, {"max","min"}); // Report the largest or smallest coordinate
+            e.max = (side == "max");
+            Util::Assert(INFO, TEST(e.dir >= 0 && e.dir < AMREX_SPACEDIM));
+            extract.fronts.push_back(e);
+        }
+        names.clear();
+        pp_queryarr("slices", names); // Names of slices / line-outs (each written to [name].dat)
+        for (auto name : names)
+        {
+            Extraction e; e.name = name;
+            IO::ParmParse pp("amr.extract." + name);
+            pp_query_required("field", e.field); // Field to sample
+            pp_query_default("comp", e.comp, 0); // Field component
+            std::string type;
+            pp_query_validate("type", type, {"plane","line"}); // Plane normal to dir, or line along dir
+            e.line = (type == "line");
+            pp_query_default("dir", e.dir, 0); // Normal (plane) or tangent (line) direction
+            pp_queryarr("x", e.x);             // A point on the plane or line
+            pp_query_default("level", e.level, 0); // AMR level to sample (uncovered points are omitted)
+            Util::Assert(INFO, TEST(e.dir >= 0 && e.dir < AMREX_SPACEDIM));
+            Util::Assert(INFO, TEST(e.level >= 0 && e.level <= maxLevel()));
+            extract.slices.push_back(e);
+        }
+        names.clear();
+        pp_queryarr("histograms", names); // Names of volume-weighted histograms (each written to [name].dat)
+        for (auto name : names)
+        {
+            Extraction e; e.name = name;
+            IO::ParmParse pp("amr.extract." + name);
+            pp_query_required("field", e.field); // Field to bin
+            pp_query_default("comp", e.comp, 0); // Field component
+            pp_query_default("lo", e.lo, 0.0);   // Lower bound of the histogram
+            pp_query_default("hi", e.hi, 1.0);   // Upper bound of the histogram
+            pp_query_default("bins", e.bins, 10); // Number of bins
+            Util::Assert(INFO, TEST(e.hi > e.lo && e.bins > 0));
+            extract.histograms.push_back(e);
+        }
+    }
 
     {
         // Instead of using AMR, prescribe an explicit, user-defined
@@ -127,6 +315,7 @@ Integrator::Integrator() : amrex::AmrCore()
     int nlevs_max = maxLevel() + 1;
 
     istep.resize(nlevs_max, 0);
+    m_last_regrid_step.resize(nlevs_max, 0);
 
     t_new.resize(nlevs_max, 0.0);
     t_old.resize(nlevs_max, -1.e100);
@@ -143,6 +332,7 @@ Integrator::Integrator() : amrex::AmrCore()
 Integrator::~Integrator()
 {
     BL_PROFILE("Integrator::~Integrator");
+    WaitForPlotFile();
     if (amrex::ParallelDescriptor::IOProcessor())
         IO::WriteMetaData(plot_file, IO::Status::Complete);
 }
@@ -207,6 +397,7 @@ Integrator::MakeNewLevelFromCoarse(int lev, amrex::Real time, const amrex::BoxAr
     {
         m_basefields_cell[n]->MakeNewLevelFromCoarse(lev, time, cgrids, dm);
     }
+    ResetBoxCost(lev, cgrids);
 
     Regrid(lev, time);
 }
@@ -224,6 +415,10 @@ Integrator::RemakeLevel(int lev,       ///<[in] AMR Level
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("Integrator::RemakeLevel");
+    // Boxes that keep their extent and owner are copied rather than filled
+    const amrex::Vector<int> reuse = ReusableBoxes(lev, cgrids, dm);
+    const bool any_reuse = std::any_of(reuse.begin(), reuse.end(), [](int j) { return j >= 0; });
+
     for (int n = 0; n < cell.number_of_fabs; n++)
     {
         const int ncomp = (*cell.fab_array[n])[lev]->nComp();
@@ -232,7 +427,12 @@ Integrator::RemakeLevel(int lev,       ///<[in] AMR Level
         amrex::MultiFab new_state(cgrids, dm, ncomp, nghost);
 
         new_state.setVal(0.0);
-        FillPatch(lev, time, *cell.fab_array[n], new_state, *cell.physbc_array[n], 0);
+        if (m_regrid.reuse && cell.derived_array[n]) { /* recomputed by the integrator */ }
+        else if (any_reuse)
+            RemakeWithReuse(*(*cell.fab_array[n])[lev], new_state, reuse, geom[lev],
+                            [&](amrex::MultiFab& a_mf) { FillPatch(lev, time, *cell.fab_array[n], a_mf, *cell.physbc_array[n], 0); });
+        else
+            FillPatch(lev, time, *cell.fab_array[n], new_state, *cell.physbc_array[n], 0);
         std::swap(new_state, *(*cell.fab_array[n])[lev]);
     }
 
@@ -247,18 +447,24 @@ Integrator::RemakeLevel(int lev,       ///<[in] AMR Level
         amrex::MultiFab new_state(ngrids, dm, ncomp, nghost);
 
         new_state.setVal(0.0);
-        FillPatch(lev, time, *node.fab_array[n], new_state, *node.physbc_array[n], 0);
+        if (m_regrid.reuse && node.derived_array[n]) { /* recomputed by the integrator */ }
+        else if (any_reuse)
+            RemakeWithReuse(*(*node.fab_array[n])[lev], new_state, reuse, geom[lev],
+                            [&](amrex::MultiFab& a_mf) { FillPatch(lev, time, *node.fab_array[n], a_mf, *node.physbc_array[n], 0); });
+        else
+            FillPatch(lev, time, *node.fab_array[n], new_state, *node.physbc_array[n], 0);
         std::swap(new_state, *(*node.fab_array[n])[lev]);
     }
 
     for (unsigned int n = 0; n < m_basefields_cell.size(); n++)
     {
-        m_basefields_cell[n]->RemakeLevel(lev, time, cgrids, dm);
+        m_basefields_cell[n]->RemakeLevel(lev, time, cgrids, dm, reuse);
     }
     for (unsigned int n = 0; n < m_basefields.size(); n++)
     {
-        m_basefields[n]->RemakeLevel(lev, time, cgrids, dm);
+        m_basefields[n]->RemakeLevel(lev, time, cgrids, dm, reuse);
     }
+    ResetBoxCost(lev, cgrids);
     Regrid(lev, time);
 }
 
@@ -279,6 +485,7 @@ Integrator::ClearLevel(int lev)
     {
         (*node.fab_array[n])[lev].reset(nullptr);
     }
+    if (m_loadbalance.on) m_loadbalance.cost_grids[lev] = amrex::BoxArray();
 }
 
 //
@@ -317,6 +524,49 @@ Integrator::RegisterNodalFab(Set::Field<Set::Scalar>& new_fab, int ncomp, int ng
 
 
 
+void
+Integrator::SetPlotTolerance(std::string a_name, Set::Scalar a_tolerance)
+{
+    BL_PROFILE("Integrator::SetPlotTolerance");
+    Util::Assert(INFO, TEST(a_tolerance >= 0.0));
+    bool found = false;
+    for (int i = 0; i < cell.number_of_fabs; i++)
+        if (cell.name_array[i] == a_name) { cell.plot_tolerance_array[i] = a_tolerance; found = true; }
+    for (int i = 0; i < node.number_of_fabs; i++)
+        if (node.name_array[i] == a_name) { node.plot_tolerance_array[i] = a_tolerance; found = true; }
+    for (unsigned int i = 0; i < m_basefields_cell.size(); i++)
+        if (m_basefields_cell[i]->getName() == a_name) { m_basefields_cell[i]->plot_tolerance = a_tolerance; found = true; }
+    for (unsigned int i = 0; i < m_basefields.size(); i++)
+        if (m_basefields[i]->getName() == a_name) { m_basefields[i]->plot_tolerance = a_tolerance; found = true; }
+    if (!found) Util::Abort(INFO, "No registered field named ", a_name);
+}
+
+void
+Integrator::SetDerived(std::string a_name)
+{
+    BL_PROFILE("Integrator::SetDerived");
+    bool found = false;
+    for (int i = 0; i < cell.number_of_fabs; i++)
+        if (cell.name_array[i] == a_name) { cell.derived_array[i] = true; found = true; }
+    for (int i = 0; i < node.number_of_fabs; i++)
+        if (node.name_array[i] == a_name) { node.derived_array[i] = true; found = true; }
+    for (unsigned int i = 0; i < m_basefields_cell.size(); i++)
+        if (m_basefields_cell[i]->getName() == a_name) { m_basefields_cell[i]->derived = true; found = true; }
+    for (unsigned int i = 0; i < m_basefields.size(); i++)
+        if (m_basefields[i]->getName() == a_name) { m_basefields[i]->derived = true; found = true; }
+    if (!found) Util::Abort(INFO, "No registered field named ", a_name);
+}
+
+void
+Integrator::SetPiecewiseConstant(std::string a_name)
+{
+    BL_PROFILE("Integrator::SetPiecewiseConstant");
+    bool found = false;
+    for (int i = 0; i < cell.number_of_fabs; i++)
+        if (cell.name_array[i] == a_name) { cell.piecewise_constant_array[i] = true; found = true; }
+    if (!found) Util::Abort(INFO, "No registered cell field named ", a_name);
+}
+
 void // CUSTOM METHOD - CHANGEABLE
 Integrator::RegisterIntegratedVariable(Set::Scalar *integrated_variable, std::string name, bool extensive)
 {
@@ -381,12 +631,7 @@ Integrator::FillPatch(int lev, amrex::Real time,
 
         physbc.define(geom[lev]);
 
-        amrex::Interpolater* mapper;
-
-        if (destination_mf.boxArray().ixType() == amrex::IndexType::TheNodeType())
-            mapper = &amrex::node_bilinear_interp;
-        else
-            mapper = &amrex::cell_cons_interp;
+        amrex::Interpolater* mapper = Mapper(source_mf, destination_mf);
 
         amrex::Vector<amrex::BCRec> bcs(destination_mf.nComp(), physbc.GetBCRec()); // todo
         amrex::FillPatchTwoLevels(destination_mf, time, cmf, ctime, fmf, ftime,
@@ -398,6 +643,86 @@ Integrator::FillPatch(int lev, amrex::Real time,
     }
 }
 
+void
+Integrator::StartGhostExchange(int lev)
+{
+    BL_PROFILE("Integrator::StartGhostExchange");
+    // The fields with ghost cells filled by TimeStep are packed into one staging MultiFab per
+    // index type, so that neighboring ranks exchange one message instead of one per
+    // field. Only the strip of valid data that a neighbor can read is copied in.
+    auto start = [&](auto& a_fields, amrex::MultiFab& a_staging, std::vector<OverlapField>& a_list) {
+        a_list.clear();
+        int ncomp = 0, nghost = 0;
+        for (int n = 0; n < a_fields.number_of_fabs; n++)
+        {
+            if (!a_fields.fill_array[n] || a_fields.nghost_array[n] == 0) continue;
+            a_list.push_back({(*a_fields.fab_array[n])[lev].get(), a_fields.physbc_array[n], ncomp});
+            ncomp += a_fields.ncomp_array[n];
+            nghost = std::max(nghost, a_fields.nghost_array[n]);
+        }
+        if (a_list.empty()) return;
+
+        const amrex::MultiFab& ref = *a_list[0].mf;
+        if (a_staging.boxArray() != ref.boxArray() || a_staging.DistributionMap() != ref.DistributionMap() ||
+            a_staging.nComp() != ncomp || a_staging.nGrow() != nghost)
+            a_staging.define(ref.boxArray(), ref.DistributionMap(), ncomp, nghost);
+
+        for (amrex::MFIter mfi(a_staging, false); mfi.isValid(); ++mfi)
+        {
+            const amrex::Box& vbx = mfi.validbox();
+            const amrex::Box inner = amrex::grow(vbx, -nghost);
+            const amrex::BoxList strip = inner.ok() ? amrex::boxDiff(vbx, inner) : amrex::BoxList(vbx);
+            amrex::Array4<Set::Scalar> const& dst = a_staging.array(mfi);
+            for (const OverlapField& f : a_list)
+            {
+                amrex::Array4<const Set::Scalar> const& src = f.mf->const_array(mfi);
+                const int scomp = f.scomp;
+                for (const amrex::Box& bx : strip)
+                    amrex::ParallelFor(bx, f.mf->nComp(), [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                        dst(i, j, k, scomp + n) = src(i, j, k, n);
+                    });
+            }
+        }
+        a_staging.FillBoundary_nowait(geom[lev].periodicity());
+    };
+    start(cell, m_overlap.cell_staging, m_overlap.cell_fields);
+    start(node, m_overlap.node_staging, m_overlap.node_fields);
+}
+
+void
+Integrator::FinishGhostExchange(int lev, amrex::Real time)
+{
+    BL_PROFILE("Integrator::FinishGhostExchange");
+    // Equivalent to FillPatch on the base level, without repeating the exchange.
+    // The ghost cells are copied back to the MultiFabs that were posted, even if
+    // the integrator has swapped its pointers since.
+    auto finish = [&](amrex::MultiFab& a_staging, std::vector<OverlapField>& a_list) {
+        if (a_list.empty()) return;
+        a_staging.FillBoundary_finish();
+        for (const OverlapField& f : a_list)
+        {
+            amrex::MultiFab& mf = *f.mf;
+            for (amrex::MFIter mfi(mf, false); mfi.isValid(); ++mfi)
+            {
+                const amrex::Box& vbx = mfi.validbox();
+                amrex::Array4<const Set::Scalar> const& src = a_staging.const_array(mfi);
+                amrex::Array4<Set::Scalar> const& dst = mf.array(mfi);
+                const int scomp = f.scomp;
+                for (const amrex::Box& bx : amrex::boxDiff(amrex::grow(vbx, mf.nGrow()), vbx))
+                    amrex::ParallelFor(bx, mf.nComp(), [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                        dst(i, j, k, n) = src(i, j, k, scomp + n);
+                    });
+            }
+            f.physbc->define(geom[lev]);
+            for (amrex::MFIter mfi(mf, true); mfi.isValid(); ++mfi)
+                f.physbc->FillBoundary(mf[mfi], mfi.tilebox(), mf.nGrow(), 0, mf.nComp(), time);
+        }
+        a_list.clear();
+    };
+    finish(m_overlap.cell_staging, m_overlap.cell_fields);
+    finish(m_overlap.node_staging, m_overlap.node_fields);
+}
+
 /// \fn    Integrator::FillCoarsePatch
 /// \brief Fill a fab at current level with the data from one level up
 ///
@@ -419,11 +744,7 @@ Integrator::FillCoarsePatch(int lev, ///<[in] AMR level
 
     physbc.define(geom[lev]);
 
-    amrex::Interpolater* mapper;
-    if (mf[lev]->boxArray().ixType() == amrex::IndexType::TheNodeType())
-        mapper = &amrex::node_bilinear_interp;
-    else
-        mapper = &amrex::cell_cons_interp;
+    amrex::Interpolater* mapper = Mapper(mf, *mf[lev]);
 
     amrex::Vector<amrex::BCRec> bcs(ncomp, physbc.GetBCRec());
     amrex::InterpFromCoarseLevel(*mf[lev], time, *cmf[0], 0, icomp, ncomp, geom[lev - 1], geom[lev],
@@ -433,11 +754,24 @@ Integrator::FillCoarsePatch(int lev, ///<[in] AMR level
         mapper, bcs, 0);
 }
 
+amrex::Interpolater*
+Integrator::Mapper(const amrex::Vector<std::unique_ptr<amrex::MultiFab>>& a_mf, const amrex::MultiFab& a_dest) const
+{
+    if (a_dest.boxArray().ixType() == amrex::IndexType::TheNodeType())
+        return &amrex::node_bilinear_interp;
+    for (int n = 0; n < cell.number_of_fabs; n++)
+        if (cell.piecewise_constant_array[n] && cell.fab_array[n] == &a_mf)
+            return &amrex::pc_interp;
+    return &amrex::cell_cons_interp;
+}
+
 void
 Integrator::ErrorEst(int lev, amrex::TagBoxArray& tags, amrex::Real time, int ngrow)
 {
     BL_PROFILE("Integrator::ErrorEst");
+    const Set::Scalar start = m_telemetry.on ? amrex::second() : 0.0;
     TagCellsForRefinement(lev, tags, time, ngrow);
+    if (m_telemetry.on) m_telemetry.tag[lev] += amrex::second() - start;
 }
 
 
@@ -446,7 +780,11 @@ Integrator::InitData()
 {
     BL_PROFILE("Integrator::InitData");
 
-    if (restart_file_cell == "" && restart_file_node == "")
+    if (restart_checkpoint != "")
+    {
+        ReadCheckpoint(restart_checkpoint);
+    }
+    else if (restart_file_cell == "" && restart_file_node == "")
     {
         const amrex::Real time = 0.0;
         InitFromScratch(time);
@@ -455,9 +793,11 @@ Integrator::InitData()
         {
             if (lev < max_level) regrid(lev, 0.0);
             for (int n = 0; n < cell.number_of_fabs; n++)
-                amrex::average_down(*(*cell.fab_array[n])[lev + 1], *(*cell.fab_array[n])[lev],
-                    geom[lev + 1], geom[lev],
-                    0, (*cell.fab_array[n])[lev]->nComp(), refRatio(lev));
+                if (!cell.piecewise_constant_array[n])
+                    amrex::average_down(*(*cell.fab_array[n])[lev + 1], *(*cell.fab_array[n])[lev],
+                        geom[lev + 1], geom[lev],
+                        0, (*cell.fab_array[n])[lev]->nComp(), refRatio(lev));
+            RestrictPiecewiseConstant(lev);
         }
         SetFinestLevel(finest_level);
     }
@@ -644,11 +984,475 @@ Integrator::Restart(const std::string dirname, bool a_nodal)
         {
             m_basefields[n]->MakeNewLevelFromScratch(lev, t_new[lev], grids[lev], dmap[lev]);
         }
+        ResetBoxCost(lev, grids[lev]);
+    }
+
+    // Timestep state (absent in older restart files)
+    std::string key;
+    while (chkpt_is >> key)
+    {
+        if (key == "timestep")
+        {
+            Set::Scalar tmp_timestep; chkpt_is >> tmp_timestep;
+            if (m_adaptive.on) timestep = tmp_timestep;
+        }
+        else if (key == "nsubsteps")
+        {
+            for (int lev = 0; lev <= max_level; lev++)
+            {
+                int tmp_nsubsteps; chkpt_is >> tmp_nsubsteps;
+                if (m_adaptive.on && m_adaptive.subcycle) nsubsteps[lev] = tmp_nsubsteps;
+            }
+        }
+    }
+    if (m_adaptive.on)
+    {
+        SetTimestep(timestep);
+        Util::Message(INFO, "Restarting with timestep ", timestep);
     }
 
     SetFinestLevel(max_level);
 }
 
+void
+Integrator::AddBoxCost(int lev, const amrex::MFIter& mfi, Set::Scalar a_cost)
+{
+    if (!m_loadbalance.on) return;
+    const int nboxes = grids[lev].size();
+    const int slot = amrex::OpenMP::get_thread_num() * nboxes + mfi.index();
+    Util::Assert(INFO, TEST(slot < (int)m_loadbalance.cost[lev].size()));
+    m_loadbalance.cost[lev][slot] += a_cost;
+}
+
+void
+Integrator::ResetBoxCost(int lev, const amrex::BoxArray& a_grids)
+{
+    if (!m_loadbalance.on) return;
+    m_loadbalance.cost[lev].assign(amrex::OpenMP::get_max_threads() * a_grids.size(), 0.0);
+    m_loadbalance.cost_grids[lev] = a_grids;
+}
+
+amrex::Vector<amrex::Real>
+Integrator::MeasuredCost(int lev)
+{
+    // All processors must agree on whether costs are available
+    int available = (m_loadbalance.cost_grids[lev] == grids[lev]);
+    amrex::ParallelDescriptor::ReduceIntMin(available);
+    if (!available) return amrex::Vector<amrex::Real>();
+
+    // Sum over threads, then over ranks
+    const int nboxes = grids[lev].size();
+    amrex::Vector<amrex::Real> cost(nboxes, 0.0);
+    for (int n = 0; n < (int)m_loadbalance.cost[lev].size(); n++) cost[n % nboxes] += m_loadbalance.cost[lev][n];
+    amrex::ParallelDescriptor::ReduceRealSum(cost.dataPtr(), (int)cost.size());
+    if (std::accumulate(cost.begin(), cost.end(), 0.0) <= 0.0) return amrex::Vector<amrex::Real>();
+    return cost;
+}
+
+amrex::DistributionMapping
+Integrator::BalancedDistributionMap(int lev, const amrex::BoxArray& ba)
+{
+    BL_PROFILE("Integrator::BalancedDistributionMap");
+    if (!m_loadbalance.on || lev > finest_level) return amrex::DistributionMapping(ba);
+    amrex::Vector<amrex::Real> cost = MeasuredCost(lev);
+    if (cost.empty()) return amrex::DistributionMapping(ba);
+
+    // Project the measured cost per cell onto the new boxes. Cells that
+    // are not in the current grids are assigned the mean cost per cell.
+    const amrex::BoxArray& oldba = grids[lev];
+    const amrex::Real mean = std::accumulate(cost.begin(), cost.end(), 0.0) / (amrex::Real)oldba.numPts();
+    amrex::Vector<amrex::Real> newcost(ba.size(), 0.0);
+    for (int n = 0; n < (int)ba.size(); n++)
+    {
+        amrex::Long covered = 0;
+        for (const auto& isect : oldba.intersections(ba[n]))
+        {
+            newcost[n] += cost[isect.first] * (amrex::Real)isect.second.numPts() / (amrex::Real)oldba[isect.first].numPts();
+            covered += isect.second.numPts();
+        }
+        newcost[n] += mean * (amrex::Real)(ba[n].numPts() - covered);
+    }
+
+    amrex::Real efficiency = 0.0;
+    if (m_loadbalance.strategy == "knapsack") return amrex::DistributionMapping::makeKnapSack(newcost, efficiency);
+    else return amrex::DistributionMapping::makeSFC(newcost, ba, efficiency);
+}
+
+void
+Integrator::regrid(int lbase, amrex::Real time, bool initial)
+{
+    BL_PROFILE("Integrator::regrid");
+    if (!m_loadbalance.on)
+    {
+        amrex::AmrCore::regrid(lbase, time, initial);
+        return;
+    }
+
+    // Same as AmrCore::regrid, except that new distributions are cost-based
+    if (lbase >= max_level) return;
+    int new_finest;
+    amrex::Vector<amrex::BoxArray> new_grids(finest_level + 2);
+    MakeNewGrids(lbase, time, new_finest, new_grids);
+
+    bool coarse_ba_changed = false;
+    for (int lev = lbase + 1; lev <= new_finest; ++lev)
+    {
+        if (lev <= finest_level)
+        {
+            bool ba_changed = (new_grids[lev] != grids[lev]);
+            if (ba_changed || coarse_ba_changed)
+            {
+                amrex::BoxArray level_grids = grids[lev];
+                amrex::DistributionMapping level_dmap = dmap[lev];
+                if (ba_changed)
+                {
+                    level_grids = new_grids[lev];
+                    level_dmap = BalancedDistributionMap(lev, level_grids);
+                }
+                RemakeLevel(lev, time, level_grids, level_dmap);
+                SetBoxArray(lev, level_grids);
+                SetDistributionMap(lev, level_dmap);
+            }
+            coarse_ba_changed = ba_changed;
+        }
+        else
+        {
+            amrex::DistributionMapping new_dmap = BalancedDistributionMap(lev, new_grids[lev]);
+            MakeNewLevelFromCoarse(lev, time, new_grids[lev], new_dmap);
+            SetBoxArray(lev, new_grids[lev]);
+            SetDistributionMap(lev, new_dmap);
+        }
+    }
+    for (int lev = new_finest + 1; lev <= finest_level; ++lev)
+    {
+        ClearLevel(lev);
+        ClearBoxArray(lev);
+        ClearDistributionMap(lev);
+    }
+    finest_level = new_finest;
+}
+
+/// For each box of `a_grids`, the index of the box of the current grids on level
+/// `lev` with the same extent and the same owner in `a_dmap`, or -1. All entries
+/// are -1 if regrid reuse is off or the level does not exist yet.
+amrex::Vector<int>
+Integrator::ReusableBoxes(int lev, const amrex::BoxArray& a_grids, const amrex::DistributionMapping& a_dmap)
+{
+    BL_PROFILE("Integrator::ReusableBoxes");
+    amrex::Vector<int> reuse(a_grids.size(), -1);
+    if (!m_regrid.reuse || lev > finest_level || grids[lev].empty()) return reuse;
+    for (int i = 0; i < (int)a_grids.size(); i++)
+    {
+        for (const std::pair<int, amrex::Box>& isect : grids[lev].intersections(a_grids[i]))
+        {
+            if (grids[lev][isect.first] == a_grids[i] && dmap[lev][isect.first] == a_dmap[i])
+                reuse[i] = isect.first;
+        }
+    }
+    return reuse;
+}
+
+void
+Integrator::Rebalance(Set::Scalar time)
+{
+    BL_PROFILE("Integrator::Rebalance");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    for (int lev = 0; lev <= finest_level; lev++)
+    {
+        amrex::Vector<amrex::Real> cost = MeasuredCost(lev);
+        if (cost.empty()) continue;
+
+        // Efficiency (mean load / max load) of the current distribution
+        amrex::Vector<amrex::Real> load(nprocs, 0.0);
+        for (int n = 0; n < (int)cost.size(); n++) load[dmap[lev][n]] += cost[n];
+        const amrex::Real current = std::accumulate(load.begin(), load.end(), 0.0) / (amrex::Real)nprocs
+                                    / *std::max_element(load.begin(), load.end());
+
+        amrex::Real efficiency = 0.0;
+        amrex::DistributionMapping new_dmap = (m_loadbalance.strategy == "knapsack")
+            ? amrex::DistributionMapping::makeKnapSack(cost, efficiency)
+            : amrex::DistributionMapping::makeSFC(cost, grids[lev], efficiency);
+
+        if (efficiency > m_loadbalance.threshold * current)
+        {
+            Util::Message(INFO, "Rebalancing level ", lev, ": efficiency ", current, " -> ", efficiency);
+            RemakeLevel(lev, time, grids[lev], new_dmap);
+            SetDistributionMap(lev, new_dmap);
+        }
+        // Start measuring afresh
+        ResetBoxCost(lev, grids[lev]);
+    }
+}
+
+std::vector<Integrator::CheckpointEntry>
+Integrator::CheckpointEntries()
+{
+    std::vector<CheckpointEntry> entries;
+    for (int i = 0; i < cell.number_of_fabs; i++)
+    {
+        Set::Field<Set::Scalar>* fab = cell.fab_array[i];
+        const int ncomp = cell.ncomp_array[i], nghost = cell.nghost_array[i];
+        entries.push_back({ "cell." + cell.name_array[i], ncomp, nghost, sizeof(Set::Scalar),
+            [fab](int lev) -> const amrex::FabArrayBase& { return *(*fab)[lev]; },
+            [fab](int lev, const amrex::MFIter& mfi) { return reinterpret_cast<char*>((*(*fab)[lev])[mfi].dataPtr()); },
+            [fab](int lev, const amrex::MFIter& mfi) { return (*(*fab)[lev])[mfi].nBytes(); },
+            [this, fab, ncomp, nghost](int lev) {
+                (*fab)[lev].reset(new amrex::MultiFab(grids[lev], dmap[lev], ncomp, nghost));
+            } });
+    }
+    for (int i = 0; i < node.number_of_fabs; i++)
+    {
+        Set::Field<Set::Scalar>* fab = node.fab_array[i];
+        const int ncomp = node.ncomp_array[i], nghost = node.nghost_array[i];
+        entries.push_back({ "node." + node.name_array[i], ncomp, nghost, sizeof(Set::Scalar),
+            [fab](int lev) -> const amrex::FabArrayBase& { return *(*fab)[lev]; },
+            [fab](int lev, const amrex::MFIter& mfi) { return reinterpret_cast<char*>((*(*fab)[lev])[mfi].dataPtr()); },
+            [fab](int lev, const amrex::MFIter& mfi) { return (*(*fab)[lev])[mfi].nBytes(); },
+            [this, fab, ncomp, nghost](int lev) {
+                amrex::BoxArray ngrids = grids[lev];
+                ngrids.convert(amrex::IntVect::TheNodeVector());
+                (*fab)[lev].reset(new amrex::MultiFab(ngrids, dmap[lev], ncomp, nghost));
+            } });
+    }
+    // BaseFields are distinguished by their position, since they may be unnamed
+    for (unsigned int i = 0; i < m_basefields.size() + m_basefields_cell.size(); i++)
+    {
+        BaseField* field = (i < m_basefields.size()) ? m_basefields[i] : m_basefields_cell[i - m_basefields.size()];
+        std::string name = (i < m_basefields.size() ? "basefield_node." : "basefield_cell.")
+            + std::to_string(i < m_basefields.size() ? i : i - m_basefields.size());
+        if (field->getName() != "") name += "." + field->getName();
+        entries.push_back({ name, field->NComp(), field->NGhost(), field->ValueBytes(),
+            [field](int lev) -> const amrex::FabArrayBase& { return field->FabArray(lev); },
+            [field](int lev, const amrex::MFIter& mfi) { return field->FabData(lev, mfi); },
+            [field](int lev, const amrex::MFIter& mfi) { return field->FabBytes(lev, mfi); },
+            [this, field](int lev) { field->MakeNewLevelFromScratch(lev, t_new[lev], grids[lev], dmap[lev]); } });
+    }
+    return entries;
+}
+
+void
+Integrator::WriteCheckpoint(std::string dirname)
+{
+    BL_PROFILE("Integrator::WriteCheckpoint");
+    // An asynchronous plotfile may still be reading the fields and using MPI
+    WaitForPlotFile();
+    const int nlevels = finest_level + 1;
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nfiles = std::min(m_checkpoint.nfiles, nprocs);
+
+    amrex::PreBuildDirectorHierarchy(dirname, "Level_", nlevels, true);
+
+    std::vector<CheckpointEntry> entries = CheckpointEntries();
+    const int nentries = (int)entries.size();
+
+    // Each processor writes its fabs to file (myproc % nfiles). Processors
+    // that share a file take turns, so at most nfiles streams are open at once.
+    // Fabs in device memory are staged through a pinned host buffer.
+#ifdef AMREX_USE_GPU
+    amrex::Gpu::PinnedVector<char> staging;
+#endif
+    amrex::Vector<amrex::Vector<amrex::Long>> offsets(nlevels);
+    for (int lev = 0; lev < nlevels; lev++)
+    {
+        const int nboxes = (int)grids[lev].size();
+        offsets[lev].resize(nentries * nboxes, 0);
+        const std::string filename = amrex::Concatenate(amrex::LevelFullPath(lev, dirname, "Level_") + "/Data_", myproc % nfiles, 5);
+        for (int round = 0; round * nfiles < nprocs; round++)
+        {
+            if (myproc / nfiles == round)
+            {
+                std::ofstream os(filename, round == 0 ? (std::ios::out | std::ios::binary | std::ios::trunc)
+                                                      : (std::ios::out | std::ios::binary | std::ios::app));
+                if (!os.good()) amrex::FileOpenFailed(filename);
+                os.seekp(0, std::ios::end);
+                amrex::Long pos = (amrex::Long)os.tellp();
+                for (int e = 0; e < nentries; e++)
+                    for (amrex::MFIter mfi(entries[e].fabarray(lev), false); mfi.isValid(); ++mfi)
+                    {
+                        const std::size_t nbytes = entries[e].nbytes(lev, mfi);
+                        offsets[lev][e * nboxes + mfi.index()] = pos;
+                        const char* data = entries[e].data(lev, mfi);
+#ifdef AMREX_USE_GPU
+                        staging.resize(nbytes);
+                        amrex::Gpu::dtoh_memcpy(staging.data(), data, nbytes);
+                        data = staging.data();
+#endif
+                        os.write(data, nbytes);
+                        pos += (amrex::Long)nbytes;
+                    }
+                if (!os.good()) Util::Abort(INFO, "Error writing ", filename);
+            }
+            amrex::ParallelDescriptor::Barrier();
+        }
+        amrex::ParallelDescriptor::ReduceLongSum(offsets[lev].dataPtr(), (int)offsets[lev].size(), ioproc);
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        std::ofstream os(dirname + "/Header");
+        if (!os.good()) amrex::FileOpenFailed(dirname + "/Header");
+        os << std::setprecision(17);
+        os << "Alamo checkpoint 1" << std::endl;
+        os << AMREX_SPACEDIM << " " << nprocs << " " << nfiles << std::endl;
+        os << t_new[0] << std::endl;
+        os << finest_level << std::endl;
+        for (int lev = 0; lev <= max_level; lev++) os << istep[lev] << " ";
+        os << std::endl;
+        for (int lev = 0; lev <= max_level; lev++) os << dt[lev] << " ";
+        os << std::endl;
+        for (int lev = 0; lev <= max_level; lev++) os << nsubsteps[lev] << " ";
+        os << std::endl;
+        for (int lev = 0; lev <= max_level; lev++) os << m_last_regrid_step[lev] << " ";
+        os << std::endl;
+        os << timestep << std::endl;
+        os << nentries << std::endl;
+        for (auto& e : entries)
+            os << e.name << " " << e.ncomp << " " << e.nghost << " " << e.value_bytes << std::endl;
+        for (int lev = 0; lev < nlevels; lev++)
+        {
+            grids[lev].writeOn(os);
+            os << std::endl;
+            const amrex::Vector<int>& pmap = dmap[lev].ProcessorMap();
+            for (int b = 0; b < (int)pmap.size(); b++) os << pmap[b] << " ";
+            os << std::endl;
+            for (int n = 0; n < (int)offsets[lev].size(); n++) os << offsets[lev][n] << " ";
+            os << std::endl;
+        }
+        std::ostringstream metadata;
+        metadata << std::setprecision(17);
+        WriteCheckpointMetadata(metadata);
+        os << metadata.str().size() << std::endl << metadata.str();
+        if (!os.good()) Util::Abort(INFO, "Error writing ", dirname, "/Header");
+    }
+    amrex::ParallelDescriptor::Barrier();
+    Util::Message(INFO, "Wrote checkpoint ", dirname);
+}
+
+void
+Integrator::ReadCheckpoint(std::string dirname)
+{
+    BL_PROFILE("Integrator::ReadCheckpoint");
+    amrex::Vector<char> headerCharPtr;
+    amrex::ParallelDescriptor::ReadAndBcastFile(dirname + "/Header", headerCharPtr);
+    std::istringstream is(std::string(headerCharPtr.dataPtr()), std::istringstream::in);
+
+    std::string line;
+    std::getline(is, line);
+    if (line != "Alamo checkpoint 1") Util::Abort(INFO, dirname, " is not an Alamo checkpoint (", line, ")");
+
+    int tmp_dim, tmp_nprocs, nfiles;
+    is >> tmp_dim >> tmp_nprocs >> nfiles;
+    if (tmp_dim != AMREX_SPACEDIM) Util::Abort(INFO, "Checkpoint was written in ", tmp_dim, "D");
+
+    Set::Scalar tmp_time;
+    is >> tmp_time;
+    for (int lev = 0; lev <= max_level; lev++) { t_new[lev] = tmp_time; t_old[lev] = tmp_time; }
+
+    int tmp_finest_level;
+    is >> tmp_finest_level;
+    if (tmp_finest_level > max_level)
+        Util::Abort(INFO, "Checkpoint has ", tmp_finest_level + 1, " levels, but amr.max_level = ", max_level);
+
+    // Per-level metadata was written for the max_level at the time of writing
+    std::getline(is, line); std::getline(is, line);
+    std::vector<std::string> tmp_istep = Util::String::Split(line);
+    std::getline(is, line);
+    std::vector<std::string> tmp_dt = Util::String::Split(line);
+    std::getline(is, line);
+    std::vector<std::string> tmp_nsubsteps = Util::String::Split(line);
+    std::getline(is, line);
+    std::vector<std::string> tmp_last_regrid_step = Util::String::Split(line);
+    for (int lev = 0; lev <= max_level && lev < (int)tmp_istep.size(); lev++)
+    {
+        istep[lev] = std::stoi(tmp_istep[lev]);
+        nsubsteps[lev] = std::stoi(tmp_nsubsteps[lev]);
+        m_last_regrid_step[lev] = std::stoi(tmp_last_regrid_step[lev]);
+    }
+    is >> timestep;
+    SetTimestep(timestep);
+    for (int lev = 0; lev <= max_level && lev < (int)tmp_dt.size(); lev++) dt[lev] = std::stod(tmp_dt[lev]);
+
+    std::vector<CheckpointEntry> entries = CheckpointEntries();
+    int nentries;
+    is >> nentries;
+    if (nentries != (int)entries.size())
+        Util::Abort(INFO, "Checkpoint has ", nentries, " fields, but ", entries.size(), " are registered");
+    for (auto& e : entries)
+    {
+        std::string name; int ncomp, nghost; std::size_t value_bytes;
+        is >> name >> ncomp >> nghost >> value_bytes;
+        if (name != e.name || ncomp != e.ncomp || nghost != e.nghost || value_bytes != e.value_bytes)
+            Util::Abort(INFO, "Checkpoint field ", name, " (ncomp=", ncomp, ", nghost=", nghost, ", bytes=", value_bytes,
+                        ") does not match registered field ", e.name,
+                        " (ncomp=", e.ncomp, ", nghost=", e.nghost, ", bytes=", e.value_bytes, ")");
+    }
+
+    // Fabs in device memory are staged through a pinned host buffer
+#ifdef AMREX_USE_GPU
+    amrex::Gpu::PinnedVector<char> staging;
+#endif
+
+    const bool same_nprocs = (tmp_nprocs == amrex::ParallelDescriptor::NProcs());
+    if (!same_nprocs)
+        Util::Warning(INFO, "Checkpoint was written on ", tmp_nprocs, " processors; data will be redistributed");
+
+    for (int lev = 0; lev <= tmp_finest_level; lev++)
+    {
+        amrex::BoxArray tmp_ba;
+        tmp_ba.readFrom(is);
+        const int nboxes = (int)tmp_ba.size();
+        amrex::Vector<int> pmap(nboxes);
+        for (int b = 0; b < nboxes; b++) is >> pmap[b];
+        amrex::Vector<amrex::Long> offsets(nentries * nboxes);
+        for (int n = 0; n < nentries * nboxes; n++) is >> offsets[n];
+
+        SetBoxArray(lev, tmp_ba);
+        if (same_nprocs) SetDistributionMap(lev, amrex::DistributionMapping(pmap));
+        else SetDistributionMap(lev, amrex::DistributionMapping(tmp_ba, amrex::ParallelDescriptor::NProcs()));
+
+        const std::string prefix = amrex::LevelFullPath(lev, dirname, "Level_") + "/Data_";
+        std::map<int, std::ifstream> files;
+        for (int e = 0; e < nentries; e++)
+        {
+            entries[e].define(lev);
+            for (amrex::MFIter mfi(entries[e].fabarray(lev), false); mfi.isValid(); ++mfi)
+            {
+                const int file = pmap[mfi.index()] % nfiles;
+                if (!files.count(file))
+                {
+                    files[file].open(amrex::Concatenate(prefix, file, 5), std::ios::in | std::ios::binary);
+                    if (!files[file].good()) amrex::FileOpenFailed(amrex::Concatenate(prefix, file, 5));
+                }
+                std::ifstream& ifs = files[file];
+                ifs.seekg(offsets[e * nboxes + mfi.index()], std::ios::beg);
+                const std::size_t nbytes = entries[e].nbytes(lev, mfi);
+#ifdef AMREX_USE_GPU
+                staging.resize(nbytes);
+                ifs.read(staging.data(), nbytes);
+                amrex::Gpu::htod_memcpy(entries[e].data(lev, mfi), staging.data(), nbytes);
+#else
+                ifs.read(entries[e].data(lev, mfi), nbytes);
+#endif
+                if (!ifs.good()) Util::Abort(INFO, "Error reading ", entries[e].name, " from ", dirname);
+            }
+        }
+    }
+    finest_level = tmp_finest_level;
+    SetFinestLevel(finest_level);
+
+    std::size_t metadata_size;
+    is >> metadata_size;
+    std::getline(is, line);
+    std::string metadata(metadata_size, ' ');
+    is.read(&metadata[0], metadata_size);
+    std::istringstream metadata_is(metadata);
+    ReadCheckpointMetadata(metadata_is);
+
+    Util::Message(INFO, "Restarted from checkpoint ", dirname, " at time ", tmp_time, ", step ", istep[0]);
+}
+
 void
 Integrator::MakeNewLevelFromScratch(int lev, amrex::Real t, const amrex::BoxArray& cgrids,
     const amrex::DistributionMapping& dm)
@@ -675,6 +1479,7 @@ Integrator::MakeNewLevelFromScratch(int lev, amrex::Real t, const amrex::BoxArra
     {
         m_basefields[n]->MakeNewLevelFromScratch(lev, t, cgrids, dm);
     }
+    ResetBoxCost(lev, cgrids);
 
     t_new[lev] = t;
     t_old[lev] = t - dt[lev];
@@ -734,6 +1539,7 @@ void
 Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initial, std::string prefix) const
 {
     BL_PROFILE("Integrator::WritePlotFile");
+
     int nlevels = finest_level + 1;
     if (max_plot_level >= 0) nlevels = std::min(nlevels, max_plot_level);
 
@@ -743,7 +1549,9 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
     {
         if (!cell.writeout_array[i]) continue;
         ccomponents += cell.ncomp_array[i];
-        if (cell.ncomp_array[i] > 1)
+        if (cell.component_names_array[i].size())
+            for (const std::string& cname : cell.component_names_array[i]) cnames.push_back(cname);
+        else if (cell.ncomp_array[i] > 1)
             for (int j = 1; j <= cell.ncomp_array[i]; j++)
                 cnames.push_back(amrex::Concatenate(cell.name_array[i], j, 3));
         else
@@ -753,7 +1561,9 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
     {
         if (!node.writeout_array[i]) continue;
         ncomponents += node.ncomp_array[i];
-        if (node.ncomp_array[i] > 1)
+        if (node.component_names_array[i].size())
+            for (const std::string& nname : node.component_names_array[i]) nnames.push_back(nname);
+        else if (node.ncomp_array[i] > 1)
             for (int j = 1; j <= node.ncomp_array[i]; j++)
                 nnames.push_back(amrex::Concatenate(node.name_array[i], j, 3));
         else
@@ -778,7 +1588,12 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
         }
     }
 
-    amrex::Vector<amrex::MultiFab> cplotmf(nlevels), nplotmf(nlevels);
+    amrex::Vector<amrex::MultiFab>& cplotmf = m_plot.cellmf;
+    amrex::Vector<amrex::MultiFab>& nplotmf = m_plot.nodemf;
+    if (cplotmf.size() < nlevels) cplotmf.resize(nlevels);
+    if (nplotmf.size() < nlevels) nplotmf.resize(nlevels);
+    if (m_plot.bfnodemf.size() < nlevels) m_plot.bfnodemf.resize(nlevels);
+    if (m_plot.bfcellmf.size() < nlevels) m_plot.bfcellmf.resize(nlevels);
 
     bool do_cell_plotfile = (ccomponents + bfcomponents_cell > 0 || (ncomponents + bfcomponents > 0 && cell.all)) && cell.any;
     bool do_node_plotfile = (ncomponents + bfcomponents > 0 || (ccomponents + bfcomponents_cell > 0 && node.all)) && node.any;
@@ -789,7 +1604,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
         {
             int ncomp = ccomponents + bfcomponents_cell;
             if (cell.all) ncomp += ncomponents + bfcomponents;
-            cplotmf[ilev].define(grids[ilev], dmap[ilev], ncomp, 0);
+            Stage(cplotmf[ilev], grids[ilev], dmap[ilev], ncomp);
 
             int n = 0;
             for (int i = 0; i < cell.number_of_fabs; i++)
@@ -798,6 +1613,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                 if ((*cell.fab_array[i])[ilev]->contains_nan()) Util::Abort(INFO, cnames[i], " contains nan (i=", i, ")");
                 if ((*cell.fab_array[i])[ilev]->contains_inf()) Util::Abort(INFO, cnames[i], " contains inf (i=", i, ")");
                 amrex::MultiFab::Copy(cplotmf[ilev], *(*cell.fab_array[i])[ilev], 0, n, cell.ncomp_array[i], 0);
+                Quantize(cplotmf[ilev], n, cell.ncomp_array[i], cell.plot_tolerance_array[i]);
                 n += cell.ncomp_array[i];
             }
             for (unsigned int i = 0; i < m_basefields_cell.size(); i++)
@@ -805,6 +1621,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                 if (m_basefields_cell[i]->writeout)
                 {
                     m_basefields_cell[i]->Copy(ilev, cplotmf[ilev], n, 0);
+                    Quantize(cplotmf[ilev], n, m_basefields_cell[i]->NComp(), m_basefields_cell[i]->plot_tolerance);
                     n += m_basefields_cell[i]->NComp();
                 }
             }
@@ -817,6 +1634,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                     if ((*node.fab_array[i])[ilev]->contains_nan()) Util::Abort(INFO, nnames[i], " contains nan (i=", i, ")");
                     if ((*node.fab_array[i])[ilev]->contains_inf()) Util::Abort(INFO, nnames[i], " contains inf (i=", i, ")");
                     amrex::average_node_to_cellcenter(cplotmf[ilev], n, *(*node.fab_array[i])[ilev], 0, node.ncomp_array[i], 0);
+                    Quantize(cplotmf[ilev], n, node.ncomp_array[i], node.plot_tolerance_array[i]);
                     n += node.ncomp_array[i];
                 }
 
@@ -824,7 +1642,8 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                 {
                     amrex::BoxArray ngrids = grids[ilev];
                     ngrids.convert(amrex::IntVect::TheNodeVector());
-                    amrex::MultiFab bfplotmf(ngrids, dmap[ilev], bfcomponents, 0);
+                    amrex::MultiFab& bfplotmf = m_plot.bfnodemf[ilev];
+                    Stage(bfplotmf, ngrids, dmap[ilev], bfcomponents);
                     int ctr = 0;
                     for (unsigned int i = 0; i < m_basefields.size(); i++)
                     {
@@ -835,7 +1654,12 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                         }
                     }
                     amrex::average_node_to_cellcenter(cplotmf[ilev], n, bfplotmf, 0, bfcomponents);
-                    n += bfcomponents;
+                    for (unsigned int i = 0; i < m_basefields.size(); i++)
+                    {
+                        if (!m_basefields[i]->writeout) continue;
+                        Quantize(cplotmf[ilev], n, m_basefields[i]->NComp(), m_basefields[i]->plot_tolerance);
+                        n += m_basefields[i]->NComp();
+                    }
                 }
             }
         }
@@ -846,7 +1670,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
             ngrids.convert(amrex::IntVect::TheNodeVector());
             int ncomp = ncomponents + bfcomponents;
             if (node.all) ncomp += ccomponents + bfcomponents_cell;
-            nplotmf[ilev].define(ngrids, dmap[ilev], ncomp, 0);
+            Stage(nplotmf[ilev], ngrids, dmap[ilev], ncomp);
 
             int n = 0;
             for (int i = 0; i < node.number_of_fabs; i++)
@@ -855,6 +1679,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                 if ((*node.fab_array[i])[ilev]->contains_nan()) Util::Warning(INFO, nnames[i], " contains nan (i=", i, "). Resetting to zero.");
                 if ((*node.fab_array[i])[ilev]->contains_inf()) Util::Abort(INFO, nnames[i], " contains inf (i=", i, ")");
                 amrex::MultiFab::Copy(nplotmf[ilev], *(*node.fab_array[i])[ilev], 0, n, node.ncomp_array[i], 0);
+                Quantize(nplotmf[ilev], n, node.ncomp_array[i], node.plot_tolerance_array[i]);
                 n += node.ncomp_array[i];
             }
             for (unsigned int i = 0; i < m_basefields.size(); i++)
@@ -862,6 +1687,7 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                 if (m_basefields[i]->writeout)
                 {
                     m_basefields[i]->Copy(ilev, nplotmf[ilev], n, 0);
+                    Quantize(nplotmf[ilev], n, m_basefields[i]->NComp(), m_basefields[i]->plot_tolerance);
                     n += m_basefields[i]->NComp();
                 }
             }
@@ -879,13 +1705,15 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                         continue;
                     }
                     Util::AverageCellcenterToNode(nplotmf[ilev], n, *(*cell.fab_array[i])[ilev], 0, cell.ncomp_array[i]);
+                    Quantize(nplotmf[ilev], n, cell.ncomp_array[i], cell.plot_tolerance_array[i]);
                     n += cell.ncomp_array[i];
                 }
 
                 if (bfcomponents_cell > 0)
                 {
                     amrex::BoxArray cgrids = grids[ilev];
-                    amrex::MultiFab bfplotmf(cgrids, dmap[ilev], bfcomponents_cell, 0);
+                    amrex::MultiFab& bfplotmf = m_plot.bfcellmf[ilev];
+                    Stage(bfplotmf, cgrids, dmap[ilev], bfcomponents_cell);
                     int ctr = 0;
                     for (unsigned int i = 0; i < m_basefields_cell.size(); i++)
                     {
@@ -896,7 +1724,12 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
                         }
                     }
                     Util::AverageCellcenterToNode(nplotmf[ilev], n, bfplotmf, 0, bfcomponents_cell);
-                    n += bfcomponents_cell;
+                    for (unsigned int i = 0; i < m_basefields_cell.size(); i++)
+                    {
+                        if (!m_basefields_cell[i]->writeout) continue;
+                        Quantize(nplotmf[ilev], n, m_basefields_cell[i]->NComp(), m_basefields_cell[i]->plot_tolerance);
+                        n += m_basefields_cell[i]->NComp();
+                    }
                 }
             }
         }
@@ -905,52 +1738,101 @@ Integrator::WritePlotFile(Set::Scalar time, amrex::Vector<int> iter, bool initia
     std::vector<std::string> plotfilename = PlotFileName(istep[0], prefix);
     if (initial) plotfilename[1] = plotfilename[1] + "init";
 
-    if (do_cell_plotfile)
-    {
-        amrex::Vector<std::string> allnames = cnames;
-        allnames.insert(allnames.end(), bfnames_cell.begin(), bfnames_cell.end());
-        if (cell.all) {
-            allnames.insert(allnames.end(), nnames.begin(), nnames.end());
-            allnames.insert(allnames.end(), bfnames.begin(), bfnames.end());
-        }
-        WriteMultiLevelPlotfile(plotfilename[0] + plotfilename[1] + "cell", nlevels, amrex::GetVecOfConstPtrs(cplotmf), allnames,
-            Geom(), time, iter, refRatio());
-
-        std::ofstream chkptfile;
-        chkptfile.open(plotfilename[0] + plotfilename[1] + "cell/Checkpoint");
-        for (int i = 0; i <= max_level; i++) boxArray(i).writeOn(chkptfile);
-        chkptfile.close();
+    amrex::Vector<std::string> callnames = cnames;
+    callnames.insert(callnames.end(), bfnames_cell.begin(), bfnames_cell.end());
+    if (cell.all) {
+        callnames.insert(callnames.end(), nnames.begin(), nnames.end());
+        callnames.insert(callnames.end(), bfnames.begin(), bfnames.end());
     }
+    amrex::Vector<std::string> nallnames = nnames;
+    nallnames.insert(nallnames.end(), bfnames.begin(), bfnames.end());
+    if (node.all) nallnames.insert(nallnames.end(), cnames.begin(), cnames.end());
+
+    // In asynchronous mode, WriteMultiLevelPlotfile hands a copy of the data
+    // to AMReX's AsyncOut, which writes it on its own thread and communicator,
+    // so everything else here runs on the main thread.
+    amrex::Vector<amrex::BoxArray> boxarrays(max_level + 1);
+    for (int i = 0; i <= max_level; i++) boxarrays[i] = boxArray(i);
+    // Timestep state, so that adaptive runs continue identically on restart
+    const amrex::Real timestep0 = dt[0];
+    const amrex::Vector<int> nsubsteps0 = nsubsteps;
+    amrex::Vector<amrex::Geometry> geoms = Geom();
+    amrex::Vector<amrex::IntVect> refratio = refRatio();
+    const int step0 = istep[0];
+    const std::string plot_file_root = plot_file;
+    const amrex::Vector<amrex::MultiFab>* cellmf = &m_plot.cellmf;
+    const amrex::Vector<amrex::MultiFab>* nodemf = &m_plot.nodemf;
+    const bool hdf5 = m_plot.hdf5;
+    const std::string compression = m_plot.compression;
+    const std::string suffix = hdf5 ? ".h5" : "/Header";
 
-    if (do_node_plotfile)
     {
-        amrex::Vector<std::string> allnames = nnames;
-        allnames.insert(allnames.end(), bfnames.begin(), bfnames.end());
-        if (node.all) allnames.insert(allnames.end(), cnames.begin(), cnames.end());
-        WriteMultiLevelPlotfile(plotfilename[0] + plotfilename[1] + "node", nlevels, amrex::GetVecOfConstPtrs(nplotmf), allnames,
-            Geom(), time, iter, refRatio());
-
-        std::ofstream chkptfile;
-        chkptfile.open(plotfilename[0] + plotfilename[1] + "node/Checkpoint");
-        for (int i = 0; i <= max_level; i++) boxArray(i).writeOn(chkptfile);
-        chkptfile.close();
-    }
+        if (do_cell_plotfile && hdf5)
+        {
+#ifdef AMREX_USE_HDF5
+            amrex::WriteMultiLevelPlotfileHDF5(plotfilename[0] + plotfilename[1] + "cell", nlevels, amrex::GetVecOfConstPtrs(*cellmf), callnames,
+                geoms, time, iter, refratio, compression);
+#endif
+        }
+        else if (do_cell_plotfile)
+        {
+            WriteMultiLevelPlotfile(plotfilename[0] + plotfilename[1] + "cell", nlevels, amrex::GetVecOfConstPtrs(*cellmf), callnames,
+                geoms, time, iter, refratio);
+
+            std::ofstream chkptfile;
+            chkptfile.open(plotfilename[0] + plotfilename[1] + "cell/Checkpoint");
+            for (unsigned int i = 0; i < boxarrays.size(); i++) boxarrays[i].writeOn(chkptfile);
+            chkptfile << std::endl << "timestep " << std::setprecision(17) << timestep0 << std::endl;
+            chkptfile << "nsubsteps"; for (int n : nsubsteps0) chkptfile << " " << n; chkptfile << std::endl;
+            chkptfile.close();
+        }
 
-    if (amrex::ParallelDescriptor::IOProcessor())
-    {
-        std::ofstream coutfile, noutfile;
-        if (istep[0] == 0)
+        if (do_node_plotfile && hdf5)
         {
-            if (do_cell_plotfile) coutfile.open(plot_file + "/celloutput.visit", std::ios_base::out);
-            if (do_node_plotfile) noutfile.open(plot_file + "/nodeoutput.visit", std::ios_base::out);
+#ifdef AMREX_USE_HDF5
+            amrex::WriteMultiLevelPlotfileHDF5(plotfilename[0] + plotfilename[1] + "node", nlevels, amrex::GetVecOfConstPtrs(*nodemf), nallnames,
+                geoms, time, iter, refratio, compression);
+#endif
         }
-        else
+        else if (do_node_plotfile)
         {
-            if (do_cell_plotfile) coutfile.open(plot_file + "/celloutput.visit", std::ios_base::app);
-            if (do_node_plotfile) noutfile.open(plot_file + "/nodeoutput.visit", std::ios_base::app);
+            WriteMultiLevelPlotfile(plotfilename[0] + plotfilename[1] + "node", nlevels, amrex::GetVecOfConstPtrs(*nodemf), nallnames,
+                geoms, time, iter, refratio);
+
+            std::ofstream chkptfile;
+            chkptfile.open(plotfilename[0] + plotfilename[1] + "node/Checkpoint");
+            for (unsigned int i = 0; i < boxarrays.size(); i++) boxarrays[i].writeOn(chkptfile);
+            chkptfile << std::endl << "timestep " << std::setprecision(17) << timestep0 << std::endl;
+            chkptfile << "nsubsteps"; for (int n : nsubsteps0) chkptfile << " " << n; chkptfile << std::endl;
+            chkptfile.close();
+        }
+
+        if (amrex::ParallelDescriptor::IOProcessor())
+        {
+            std::ofstream coutfile, noutfile;
+            if (step0 == 0)
+            {
+                if (do_cell_plotfile) coutfile.open(plot_file_root + "/celloutput.visit", std::ios_base::out);
+                if (do_node_plotfile) noutfile.open(plot_file_root + "/nodeoutput.visit", std::ios_base::out);
+            }
+            else
+            {
+                if (do_cell_plotfile) coutfile.open(plot_file_root + "/celloutput.visit", std::ios_base::app);
+                if (do_node_plotfile) noutfile.open(plot_file_root + "/nodeoutput.visit", std::ios_base::app);
+            }
+            if (do_cell_plotfile) coutfile << plotfilename[1] + "cell" + suffix << std::endl;
+            if (do_node_plotfile) noutfile << plotfilename[1] + "node" + suffix << std::endl;
         }
-        if (do_cell_plotfile) coutfile << plotfilename[1] + "cell" + "/Header" << std::endl;
-        if (do_node_plotfile) noutfile << plotfilename[1] + "node" + "/Header" << std::endl;
+    }
+}
+
+void
+Integrator::WaitForPlotFile() const
+{
+    if (m_plot.async)
+    {
+        BL_PROFILE("Integrator::WaitForPlotFile");
+        amrex::AsyncOut::Wait();
     }
 }
 
@@ -968,11 +1850,29 @@ Integrator::Evolve()
         }
         int lev = 0;
         int iteration = 1;
+        for (auto& estimate : m_adaptive.estimate) estimate = std::numeric_limits<Set::Scalar>::max();
+        const Set::Scalar step_dt = dt[0];
+        const Set::Scalar step_start = amrex::second();
+        Set::Scalar start = step_start;
+        // Add the time since the last call to the given telemetry counter
+        auto lap = [&](Set::Scalar& counter) {
+            if (!m_telemetry.on) return;
+            const Set::Scalar now = amrex::second();
+            counter += now - start;
+            start = now;
+        };
         TimeStepBegin(cur_time, step);
+        lap(m_telemetry.begin);
         if (integrate_variables_before_advance) IntegrateVariables(cur_time, step);
+        lap(m_telemetry.integrate);
+        ExtractVariables(cur_time, step);
+        lap(m_telemetry.extract);
         TimeStep(lev, cur_time, iteration);
+        start = amrex::second();
         if (integrate_variables_after_advance) IntegrateVariables(cur_time, step);
+        lap(m_telemetry.integrate);
         TimeStepComplete(cur_time, step);
+        lap(m_telemetry.complete);
         cur_time += dt[0];
 
         if (amrex::ParallelDescriptor::IOProcessor()) {
@@ -986,6 +1886,9 @@ Integrator::Evolve()
             t_new[lev] = cur_time;
         }
 
+        if (m_adaptive.on) AdaptTimestep(cur_time);
+        start = amrex::second();
+
         if (plot_int > 0 && (step + 1) % plot_int == 0) {
             last_plot_file_step = step + 1;
             WritePlotFile();
@@ -998,11 +1901,164 @@ Integrator::Evolve()
             IO::WriteMetaData(plot_file, IO::Status::Running, (int)(100.0 * cur_time / stop_time));
         }
 
+        lap(m_telemetry.output);
+
+        if (m_loadbalance.on && m_loadbalance.interval > 0 && (step + 1) % m_loadbalance.interval == 0)
+            Rebalance(cur_time);
+        lap(m_telemetry.rebalance);
+
+        if (m_checkpoint.interval > 0 && (step + 1) % m_checkpoint.interval == 0)
+            WriteCheckpoint(amrex::Concatenate(plot_file + "/chk", step + 1, 5));
+
+        if (m_telemetry.on)
+        {
+            lap(m_telemetry.output);
+            m_telemetry.total += amrex::second() - step_start;
+            if ((step + 1) % m_telemetry.interval == 0) WriteTelemetry(cur_time, step + 1, step_dt);
+        }
+
         if (cur_time >= stop_time - 1.e-6 * dt[0]) break;
     }
     if (plot_int > 0 && istep[0] > last_plot_file_step) {
         WritePlotFile();
     }
+    WaitForPlotFile();
+}
+
+void
+Integrator::AdaptTimestep(Set::Scalar cur_time)
+{
+    BL_PROFILE("Integrator::AdaptTimestep");
+    const int nlevs = finest_level + 1;
+    amrex::Vector<Set::Scalar> estimate(m_adaptive.estimate.begin(), m_adaptive.estimate.begin() + nlevs);
+    amrex::ParallelDescriptor::ReduceRealMin(estimate.dataPtr(), nlevs);
+
+    bool reported = false;
+    for (int lev = 0; lev < nlevs; lev++)
+        if (estimate[lev] < std::numeric_limits<Set::Scalar>::max()) reported = true;
+    if (!reported)
+    {
+        static bool warned = false;
+        if (!warned) Util::Warning(INFO, "amr.adaptive_dt.on is set, but no stable timestep was reported");
+        warned = true;
+        return;
+    }
+
+    // Largest coarse timestep allowed by each level, given the number of
+    // substeps that level can take per coarse step.
+    Set::Scalar dt0 = m_adaptive.max;
+    Set::Scalar nsub = 1.0;
+    for (int lev = 0; lev < nlevs; lev++)
+    {
+        if (lev > 0) nsub *= (Set::Scalar)(m_adaptive.subcycle ? MaxRefRatio(lev - 1) : nsubsteps[lev]);
+        if (estimate[lev] < std::numeric_limits<Set::Scalar>::max())
+            dt0 = std::min(dt0, m_adaptive.cfl * estimate[lev] * nsub);
+    }
+    dt0 = std::min(dt0, m_adaptive.growth * dt[0]);
+    dt0 = std::max(dt0, m_adaptive.min);
+    if (cur_time < stop_time) dt0 = std::min(dt0, stop_time - cur_time);
+
+    timestep = dt0;
+    dt[0] = dt0;
+    for (int lev = 1; lev <= max_level; lev++)
+    {
+        if (m_adaptive.subcycle && lev < nlevs && estimate[lev] < std::numeric_limits<Set::Scalar>::max())
+        {
+            int n = (int)std::ceil(dt[lev - 1] / (m_adaptive.cfl * estimate[lev]) - 1E-8);
+            nsubsteps[lev] = std::max(1, std::min(MaxRefRatio(lev - 1), n));
+        }
+        dt[lev] = dt[lev - 1] / (amrex::Real)nsubsteps[lev];
+    }
+}
+
+void
+Integrator::RecordSolve(Set::Scalar a_walltime, int a_newton_iters, int a_linear_iters, Set::Scalar a_residual)
+{
+    if (!m_telemetry.on) return;
+    m_telemetry.solve += a_walltime;
+    m_telemetry.newton_iters += a_newton_iters;
+    m_telemetry.linear_iters += a_linear_iters;
+    if (!std::isnan(a_residual)) m_telemetry.residual = a_residual;
+}
+
+void
+Integrator::WriteTelemetry(Set::Scalar cur_time, int step, Set::Scalar step_dt)
+{
+    BL_PROFILE("Integrator::WriteTelemetry");
+    const int nlevs = max_level + 1;
+
+    // Use the slowest rank for every timer
+    amrex::Vector<Set::Scalar> times;
+    for (int lev = 0; lev < nlevs; lev++)
+    {
+        times.push_back(m_telemetry.fillpatch[lev]);
+        times.push_back(m_telemetry.advance[lev]);
+        times.push_back(m_telemetry.regrid[lev]);
+        times.push_back(m_telemetry.tag[lev]);
+    }
+    times.push_back(m_telemetry.begin);
+    times.push_back(m_telemetry.solve);
+    times.push_back(m_telemetry.complete);
+    times.push_back(m_telemetry.rebalance);
+    times.push_back(m_telemetry.integrate);
+    times.push_back(m_telemetry.extract);
+    times.push_back(m_telemetry.output);
+    times.push_back(m_telemetry.total);
+
+    // Resident set high-water mark (reported in kB on Linux and in bytes on macOS)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    times.push_back((Set::Scalar)usage.ru_maxrss / 1048576.0);
+#else
+    times.push_back((Set::Scalar)usage.ru_maxrss / 1024.0);
+#endif
+
+    amrex::ParallelDescriptor::ReduceRealMax(times.dataPtr(), (int)times.size());
+
+    // Memory currently allocated in FABs, summed over all ranks
+    Set::Scalar fab_mb = (Set::Scalar)amrex::TotalBytesAllocatedInFabs() / 1048576.0;
+    amrex::ParallelDescriptor::ReduceRealSum(fab_mb);
+
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        // Start a new file unless this is a restarted run, in which case append to the old one
+        std::ofstream outfile;
+        if (!m_telemetry.written && step <= m_telemetry.interval)
+        {
+            outfile.open(plot_file + "/telemetry.dat", std::ios_base::out);
+            outfile << "step" << "\t" << "time" << "\t" << "dt";
+            for (int lev = 0; lev < nlevs; lev++)
+                for (std::string name : {"cells", "fillpatch", "advance", "regrid", "tag"})
+                    outfile << "\t" << name << "_" << lev;
+            outfile << "\t" << "begin" << "\t" << "solve" << "\t" << "newton_iters" << "\t" << "linear_iters"
+                    << "\t" << "residual" << "\t" << "complete" << "\t" << "rebalance" << "\t" << "integrate" << "\t" << "extract"
+                    << "\t" << "output" << "\t" << "total" << "\t" << "memory_mb" << "\t" << "fab_mb" << std::endl;
+        }
+        else outfile.open(plot_file + "/telemetry.dat", std::ios_base::app);
+
+        outfile << step << "\t" << cur_time << "\t" << step_dt;
+        int n = 0;
+        for (int lev = 0; lev < nlevs; lev++, n += 4)
+        {
+            outfile << "\t" << (lev <= finest_level ? boxArray(lev).numPts() : 0);
+            for (int i = 0; i < 4; i++) outfile << "\t" << times[n + i];
+        }
+        outfile << "\t" << times[n] << "\t" << times[n + 1]
+                << "\t" << m_telemetry.newton_iters << "\t" << m_telemetry.linear_iters
+                << "\t" << m_telemetry.residual;
+        for (int i = n + 2; i < (int)times.size(); i++) outfile << "\t" << times[i];
+        outfile << "\t" << fab_mb << std::endl;
+        outfile.close();
+    }
+    m_telemetry.written = true;
+
+    for (int lev = 0; lev < nlevs; lev++)
+        m_telemetry.fillpatch[lev] = m_telemetry.advance[lev] = m_telemetry.regrid[lev] = m_telemetry.tag[lev] = 0.0;
+    m_telemetry.begin = m_telemetry.solve = m_telemetry.complete = m_telemetry.rebalance = 0.0;
+    m_telemetry.integrate = m_telemetry.extract = m_telemetry.output = m_telemetry.total = 0.0;
+    m_telemetry.newton_iters = m_telemetry.linear_iters = 0;
+    m_telemetry.residual = NAN;
 }
 
 void
@@ -1020,44 +2076,62 @@ Integrator::IntegrateVariables(amrex::Real time, int step)
             if (thermo.extensives[i]) *thermo.vars[i] = 0;
         }
 
-        // All levels except the finest
-        for (int ilev = 0; ilev < max_level; ilev++)
+        // The coarse/fine complement of each tile only changes on regrid, so it is
+        // computed once and reused until the grids or distribution change.
+        thermo.boxes.resize(max_level + 1);
+        thermo.boxes_grids.resize(max_level + 1);
+        thermo.boxes_dmap.resize(max_level + 1);
+        for (int ilev = 0; ilev <= max_level; ilev++)
         {
-            const amrex::BoxArray& cfba = amrex::coarsen(grids[ilev + 1], refRatio(ilev));
-
-#ifdef OMP
-#pragma omp parallel
-#endif
+            bool stale = !(thermo.boxes_grids[ilev] == grids[ilev]) || !(thermo.boxes_dmap[ilev] == dmap[ilev]);
+            if (ilev < max_level)
+                stale = stale || !(thermo.boxes_grids[ilev + 1] == grids[ilev + 1]);
+            if (!stale) continue;
+
+            thermo.boxes[ilev].clear();
+            amrex::BoxArray cfba;
+            if (ilev < max_level) cfba = amrex::coarsen(grids[ilev + 1], refRatio(ilev));
             for (amrex::MFIter mfi(grids[ilev], dmap[ilev], true); mfi.isValid(); ++mfi)
             {
                 const amrex::Box& box = mfi.tilebox();
-                const amrex::BoxArray& comp = amrex::complementIn(box, cfba);
-
-                for (int i = 0; i < comp.size(); i++)
+                if ((int)thermo.boxes[ilev].size() <= mfi.LocalTileIndex())
+                    thermo.boxes[ilev].resize(mfi.LocalTileIndex() + 1);
+                if (ilev < max_level)
                 {
-                    Integrate(ilev, time, step,
-                        mfi, comp[i]);
+                    const amrex::BoxArray& comp = amrex::complementIn(box, cfba);
+                    for (int i = 0; i < comp.size(); i++)
+                        thermo.boxes[ilev][mfi.LocalTileIndex()].push_back(comp[i]);
                 }
+                else thermo.boxes[ilev][mfi.LocalTileIndex()].push_back(box);
             }
         }
-        // Now do the finest level
+        // Record the layout the cached boxes were built for
+        for (int ilev = 0; ilev <= max_level; ilev++)
+        {
+            thermo.boxes_grids[ilev] = grids[ilev];
+            thermo.boxes_dmap[ilev] = dmap[ilev];
+        }
+
+        for (int ilev = 0; ilev <= max_level; ilev++)
         {
 #ifdef OMP
 #pragma omp parallel
-#endif 
-            for (amrex::MFIter mfi(grids[max_level], dmap[max_level], true); mfi.isValid(); ++mfi)
+#endif
+            for (amrex::MFIter mfi(grids[ilev], dmap[ilev], true); mfi.isValid(); ++mfi)
             {
-                const amrex::Box& box = mfi.tilebox();
-                Integrate(max_level, time, step, mfi, box);
+                for (const amrex::Box& box : thermo.boxes[ilev][mfi.LocalTileIndex()])
+                    Integrate(ilev, time, step, mfi, box);
             }
         }
 
-        // Sum up across all processors
+        // Sum up across all processors in a single reduction
+        std::vector<Set::Scalar> sums;
         for (int i = 0; i < thermo.number; i++)
-        {
-            if (thermo.extensives[i])
-                amrex::ParallelDescriptor::ReduceRealSum(*thermo.vars[i]);
-        }
+            if (thermo.extensives[i]) sums.push_back(*thermo.vars[i]);
+        if (sums.size())
+            amrex::ParallelDescriptor::ReduceRealSum(sums.data(), (int)sums.size());
+        for (int i = 0, n = 0; i < thermo.number; i++)
+            if (thermo.extensives[i]) *thermo.vars[i] = sums[n++];
     }
     if (amrex::ParallelDescriptor::IOProcessor() &&
         (
@@ -1085,27 +2159,316 @@ Integrator::IntegrateVariables(amrex::Real time, int step)
 }
 
 
+void
+Integrator::ExtractVariables(amrex::Real time, int step)
+{
+    BL_PROFILE("Integrator::ExtractVariables");
+    if (extract.probes.empty() && extract.fronts.empty() &&
+        extract.slices.empty() && extract.histograms.empty()) return;
+    if (!((extract.interval > 0 && step % extract.interval == 0) ||
+          (extract.dt > 0.0 && std::fabs(std::remainder(time, extract.dt)) < 0.5 * dt[0]))) return;
+
+    const std::string dirname = plot_file + "/extract";
+    const bool first = !extract.initialized;
+
+    // Fields are registered after amr.extract is parsed, so look them up on first use
+    if (first)
+    {
+        auto resolve = [&](Extraction& e) {
+            for (int i = 0; i < cell.number_of_fabs; i++)
+                if (cell.name_array[i] == e.field)
+                {
+                    e.fab = cell.fab_array[i]; e.nodal = false;
+                    Util::Assert(INFO, TEST(e.comp >= 0 && e.comp < cell.ncomp_array[i]));
+                }
+            for (int i = 0; i < node.number_of_fabs; i++)
+                if (node.name_array[i] == e.field)
+                {
+                    e.fab = node.fab_array[i]; e.nodal = true;
+                    Util::Assert(INFO, TEST(e.comp >= 0 && e.comp < node.ncomp_array[i]));
+                }
+            if (!e.fab) Util::Abort(INFO, "amr.extract.", e.name, ": no scalar field named ", e.field);
+        };
+        for (auto& e : extract.probes) resolve(e);
+        for (auto& e : extract.fronts) resolve(e);
+        for (auto& e : extract.slices) resolve(e);
+        for (auto& e : extract.histograms) resolve(e);
+        if (amrex::ParallelDescriptor::IOProcessor())
+            if (!amrex::UtilCreateDirectory(dirname, 0755))
+                amrex::CreateDirectoryFailed(dirname);
+        amrex::ParallelDescriptor::Barrier();
+        extract.initialized = true;
+    }
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+
+    // The composite grid only changes on regrid, so the complement of the finer
+    // level in each box is computed once and reused until the grids change.
+    extract.boxes.resize(max_level + 1);
+    extract.boxes_grids.resize(max_level + 1);
+    extract.boxes_dmap.resize(max_level + 1);
+    for (int lev = 0; lev <= finest_level; lev++)
+    {
+        bool stale = !(extract.boxes_grids[lev] == grids[lev]) || !(extract.boxes_dmap[lev] == dmap[lev]);
+        if (lev < finest_level) stale = stale || !(extract.boxes_grids[lev + 1] == grids[lev + 1]);
+        else stale = stale || (lev < max_level && !extract.boxes_grids[lev + 1].empty());
+        if (!stale) continue;
+
+        extract.boxes[lev].clear();
+        amrex::BoxArray cfba;
+        if (lev < finest_level) cfba = amrex::coarsen(grids[lev + 1], refRatio(lev));
+        for (amrex::MFIter mfi(grids[lev], dmap[lev], false); mfi.isValid(); ++mfi)
+        {
+            if ((int)extract.boxes[lev].size() <= mfi.LocalIndex())
+                extract.boxes[lev].resize(mfi.LocalIndex() + 1);
+            const amrex::BoxArray comp = (lev < finest_level) ? amrex::complementIn(mfi.validbox(), cfba)
+                                                              : amrex::BoxArray(mfi.validbox());
+            for (int n = 0; n < comp.size(); n++) extract.boxes[lev][mfi.LocalIndex()].push_back(comp[n]);
+        }
+    }
+    for (int lev = 0; lev <= max_level; lev++)
+    {
+        extract.boxes_grids[lev] = lev <= finest_level ? grids[lev] : amrex::BoxArray();
+        extract.boxes_dmap[lev] = lev <= finest_level ? dmap[lev] : amrex::DistributionMapping();
+    }
+
+    //
+    // Point probes: sample the finest level that covers the point
+    //
+    std::vector<Set::Scalar> probes;
+    for (auto& e : extract.probes)
+    {
+        const Set::Field<Set::Scalar>& fab = *e.fab;
+        Set::Scalar value = 0.0, count = 0.0;
+        for (int lev = fab.finest_level; lev >= 0; lev--)
+        {
+            const Set::Scalar* DX = geom[lev].CellSize();
+            const Set::Scalar* plo = geom[lev].ProbLo();
+            amrex::IntVect civ(AMREX_D_DECL((int)std::floor((e.x(0) - plo[0]) / DX[0]),
+                                            (int)std::floor((e.x(1) - plo[1]) / DX[1]),
+                                            (int)std::floor((e.x(2) - plo[2]) / DX[2])));
+            if (!grids[lev].contains(civ)) continue;
+            amrex::IntVect iv = civ;
+            if (e.nodal)
+                iv = amrex::IntVect(AMREX_D_DECL((int)std::round((e.x(0) - plo[0]) / DX[0]),
+                                                 (int)std::round((e.x(1) - plo[1]) / DX[1]),
+                                                 (int)std::round((e.x(2) - plo[2]) / DX[2])));
+            // A one-point reduction reads the value wherever the data lives (host or device)
+            const int comp = e.comp;
+            for (amrex::MFIter mfi(*fab[lev], false); mfi.isValid(); ++mfi)
+            {
+                if (!mfi.validbox().contains(iv)) continue;
+                amrex::Array4<const Set::Scalar> const& data = fab[lev]->const_array(mfi);
+                amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+                amrex::ReduceData<Set::Scalar> reduce_data(reduce_op);
+                using ReduceTuple = typename decltype(reduce_data)::Type;
+                reduce_op.eval(amrex::Box(iv, iv, mfi.validbox().ixType()), reduce_data,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple { return { data(i, j, k, comp) }; });
+                value += amrex::get<0>(reduce_data.value(reduce_op));
+                count += 1.0;
+            }
+            break;
+        }
+        // Nodes on grid boundaries are owned by several boxes, so average
+        amrex::ParallelDescriptor::ReduceRealSum(value);
+        amrex::ParallelDescriptor::ReduceRealSum(count);
+        probes.push_back(count > 0.0 ? value / count : NAN);
+    }
+
+    //
+    // Fronts: extremal coordinate of the region where field >= value
+    //
+    std::vector<Set::Scalar> fronts;
+    for (auto& e : extract.fronts)
+    {
+        // Fronts at the min are found as the max of -x
+        const Set::Scalar none = std::numeric_limits<Set::Scalar>::lowest();
+        const Set::Scalar sign = e.max ? 1.0 : -1.0, threshold = e.value;
+        const int comp = e.comp, dir = e.dir;
+        const bool nodal = e.nodal;
+        amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+        amrex::ReduceData<Set::Scalar> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        for (int lev = 0; lev <= finest_level; lev++)
+        {
+            const Set::Scalar lo = geom[lev].ProbLo()[dir], dx = geom[lev].CellSize()[dir];
+            for (amrex::MFIter mfi(*(*e.fab)[lev], false); mfi.isValid(); ++mfi)
+            {
+                amrex::Array4<const Set::Scalar> const& data = (*e.fab)[lev]->const_array(mfi);
+                for (const amrex::Box& bx : extract.boxes[lev][mfi.LocalIndex()])
+                    reduce_op.eval(bx, reduce_data, [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                        if (CellValue(data, i, j, k, comp, nodal) < threshold) return { none };
+                        const int ijk[3] = { i, j, k };
+                        return { sign * (lo + ((Set::Scalar)ijk[dir] + 0.5) * dx) };
+                    });
+            }
+        }
+        Set::Scalar pos = amrex::get<0>(reduce_data.value(reduce_op));
+        amrex::ParallelDescriptor::ReduceRealMax(pos);
+        pos = (pos == none) ? NAN : sign * pos;
+        fronts.push_back(pos);
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor() && (extract.probes.size() || extract.fronts.size()))
+    {
+        std::ofstream outfile;
+        if (first)
+        {
+            outfile.open(dirname + "/scalars.dat", std::ios_base::out);
+            outfile << "time";
+            for (auto& e : extract.probes) outfile << "\t" << e.name;
+            for (auto& e : extract.fronts) outfile << "\t" << e.name;
+            outfile << std::endl;
+        }
+        else outfile.open(dirname + "/scalars.dat", std::ios_base::app);
+        outfile << time;
+        for (auto& v : probes) outfile << "\t" << v;
+        for (auto& v : fronts) outfile << "\t" << v;
+        outfile << std::endl;
+    }
+
+    //
+    // Slices and line-outs on a single level, gathered to the I/O processor
+    //
+    for (auto& e : extract.slices)
+    {
+        const Set::Field<Set::Scalar>& fab = *e.fab;
+        const int lev = std::min(e.level, fab.finest_level);
+        const Set::Scalar* DX = geom[lev].CellSize();
+        const Set::Scalar* plo = geom[lev].ProbLo();
+
+        amrex::Box domain = geom[lev].Domain();
+        if (e.nodal) domain.surroundingNodes();
+        amrex::Box sbox = domain;
+        for (int d = 0; d < AMREX_SPACEDIM; d++)
+        {
+            if (e.line == (d == e.dir)) continue;
+            int idx = e.nodal ? (int)std::round((e.x(d) - plo[d]) / DX[d])
+                              : (int)std::floor((e.x(d) - plo[d]) / DX[d]);
+            idx = std::max(domain.smallEnd(d), std::min(domain.bigEnd(d), idx));
+            sbox.setSmall(d, idx);
+            sbox.setBig(d, idx);
+        }
+
+        const long npts = sbox.numPts();
+        amrex::Gpu::DeviceVector<Set::Scalar> dvalues(npts, 0.0), dcounts(npts, 0.0);
+        Set::Scalar* pvalues = dvalues.data();
+        Set::Scalar* pcounts = dcounts.data();
+        const int comp = e.comp;
+        for (amrex::MFIter mfi(*fab[lev], false); mfi.isValid(); ++mfi)
+        {
+            const amrex::Box bx = mfi.validbox() & sbox;
+            if (!bx.ok()) continue;
+            amrex::Array4<const Set::Scalar> const& data = fab[lev]->const_array(mfi);
+            // Nodes on box boundaries are visited by several boxes
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                const long n = sbox.index(amrex::IntVect(AMREX_D_DECL(i, j, k)));
+                amrex::Gpu::Atomic::AddNoRet(pvalues + n, data(i, j, k, comp));
+                amrex::Gpu::Atomic::AddNoRet(pcounts + n, (Set::Scalar)1.0);
+            });
+        }
+        std::vector<Set::Scalar> values(npts), counts(npts);
+        amrex::Gpu::copy(amrex::Gpu::deviceToHost, dvalues.begin(), dvalues.end(), values.begin());
+        amrex::Gpu::copy(amrex::Gpu::deviceToHost, dcounts.begin(), dcounts.end(), counts.begin());
+        amrex::ParallelDescriptor::ReduceRealSum(values.data(), (int)npts, ioproc);
+        amrex::ParallelDescriptor::ReduceRealSum(counts.data(), (int)npts, ioproc);
+
+        if (amrex::ParallelDescriptor::IOProcessor())
+        {
+            std::ofstream outfile(dirname + "/" + e.name + ".dat", first ? std::ios_base::out : std::ios_base::app);
+            outfile << "# time = " << time << " step = " << step << " level = " << lev << std::endl;
+            const Set::Scalar shift = e.nodal ? 0.0 : 0.5;
+            for (long n = 0; n < npts; n++)
+            {
+                if (counts[n] == 0.0) continue;
+                amrex::IntVect iv = sbox.atOffset(n);
+                for (int d = 0; d < AMREX_SPACEDIM; d++)
+                    outfile << plo[d] + ((Set::Scalar)iv[d] + shift) * DX[d] << "\t";
+                outfile << values[n] / counts[n] << std::endl;
+            }
+            outfile << std::endl;
+        }
+    }
+
+    //
+    // Volume-weighted histograms over the composite grid
+    //
+    for (auto& e : extract.histograms)
+    {
+        const Set::Scalar width = (e.hi - e.lo) / (Set::Scalar)e.bins;
+        const Set::Scalar hlo = e.lo, hhi = e.hi;
+        const int bins = e.bins, comp = e.comp;
+        const bool nodal = e.nodal;
+        amrex::Gpu::DeviceVector<Set::Scalar> dhist(bins, 0.0);
+        Set::Scalar* phist = dhist.data();
+        for (int lev = 0; lev <= finest_level; lev++)
+        {
+            const Set::Scalar* DX = geom[lev].CellSize();
+            const Set::Scalar vol = AMREX_D_TERM(DX[0], *DX[1], *DX[2]);
+            for (amrex::MFIter mfi(*(*e.fab)[lev], false); mfi.isValid(); ++mfi)
+            {
+                amrex::Array4<const Set::Scalar> const& data = (*e.fab)[lev]->const_array(mfi);
+                for (const amrex::Box& bx : extract.boxes[lev][mfi.LocalIndex()])
+                    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                        const Set::Scalar value = CellValue(data, i, j, k, comp, nodal);
+                        if (value < hlo || value > hhi) return;
+                        const int bin = amrex::min(bins - 1, (int)((value - hlo) / width));
+                        amrex::Gpu::Atomic::AddNoRet(phist + bin, vol);
+                    });
+            }
+        }
+        std::vector<Set::Scalar> hist(bins);
+        amrex::Gpu::copy(amrex::Gpu::deviceToHost, dhist.begin(), dhist.end(), hist.begin());
+        amrex::ParallelDescriptor::ReduceRealSum(hist.data(), e.bins, ioproc);
+
+        if (amrex::ParallelDescriptor::IOProcessor())
+        {
+            std::ofstream outfile;
+            if (first)
+            {
+                outfile.open(dirname + "/" + e.name + ".dat", std::ios_base::out);
+                outfile << "time";
+                for (int n = 0; n < e.bins; n++) outfile << "\t" << e.lo + ((Set::Scalar)n + 0.5) * width;
+                outfile << std::endl;
+            }
+            else outfile.open(dirname + "/" + e.name + ".dat", std::ios_base::app);
+            outfile << time;
+            for (int n = 0; n < e.bins; n++) outfile << "\t" << hist[n];
+            outfile << std::endl;
+        }
+    }
+}
+
 void
 Integrator::TimeStep(int lev, amrex::Real time, int /*iteration*/)
 {
     BL_PROFILE("Integrator::TimeStep");
+    Set::Scalar start = m_telemetry.on ? amrex::second() : 0.0;
+    // Tagging happens inside regrid and is reported separately, so it is taken out of the regrid time
+    const Set::Scalar tag_start = m_telemetry.on ? std::accumulate(m_telemetry.tag.begin(), m_telemetry.tag.end(), 0.0) : 0.0;
     if (base_regrid_int <= 0 || istep[0] % base_regrid_int == 0)
     {
         if (regrid_int > 0 || base_regrid_int > 0)  // We may need to regrid
         {
-            static amrex::Vector<int> last_regrid_step(max_level + 1, 0);
-
             // regrid doesn't change the base level, so we don't regrid on max_level
-            if (lev < max_level && istep[lev] > last_regrid_step[lev])
+            if (lev < max_level && istep[lev] > m_last_regrid_step[lev])
             {
                 if (istep[lev] % regrid_int == 0)
                 {
                     regrid(lev, time, false);
+                    m_last_regrid_step[lev] = istep[lev];
                 }
             }
         }
     }
     SetFinestLevel(finest_level);
+    if (m_telemetry.on)
+    {
+        const Set::Scalar now = amrex::second();
+        const Set::Scalar tag = std::accumulate(m_telemetry.tag.begin(), m_telemetry.tag.end(), 0.0) - tag_start;
+        m_telemetry.regrid[lev] += now - start - tag;
+        start = now;
+    }
 
     if (Verbose() && amrex::ParallelDescriptor::IOProcessor()) {
         std::cout << "[Level " << lev
@@ -1115,17 +2478,53 @@ Integrator::TimeStep(int lev, amrex::Real time, int /*iteration*/)
             << std::endl;
     }
 
-    for (int n = 0; n < cell.number_of_fabs; n++)
-        FillPatch(lev, time, *cell.fab_array[n], *(*cell.fab_array[n])[lev], *cell.physbc_array[n], 0);
-    for (int n = 0; n < node.number_of_fabs; n++)
-        FillPatch(lev, time, *node.fab_array[n], *(*node.fab_array[n])[lev], *node.physbc_array[n], 0);
+    // On the base level, FillPatch is just a ghost exchange plus the physical
+    // boundary conditions, so the exchanges of all scalar fields can be posted
+    // together and completed after the interior has been advanced.
+    const bool overlap = m_overlap.on && lev == 0;
+    if (overlap) StartGhostExchange(lev);
+    else
+    {
+        for (int n = 0; n < cell.number_of_fabs; n++)
+            if (cell.fill_array[n])
+                FillPatch(lev, time, *cell.fab_array[n], *(*cell.fab_array[n])[lev], *cell.physbc_array[n], 0);
+        for (int n = 0; n < node.number_of_fabs; n++)
+            if (node.fill_array[n])
+                FillPatch(lev, time, *node.fab_array[n], *(*node.fab_array[n])[lev], *node.physbc_array[n], 0);
+    }
     for (unsigned int n = 0; n < m_basefields_cell.size(); n++)
         if (m_basefields_cell[n]->evolving) m_basefields_cell[n]->FillPatch(lev, time);
     for (unsigned int n = 0; n < m_basefields.size(); n++)
         if (m_basefields[n]->evolving) m_basefields[n]->FillPatch(lev, time);
+    if (m_telemetry.on)
+    {
+        const Set::Scalar now = amrex::second();
+        m_telemetry.fillpatch[lev] += now - start;
+        start = now;
+    }
 
-    Advance(lev, time, dt[lev]);
+    if (overlap)
+    {
+        const bool split = AdvanceOverlap(lev, time, dt[lev], true);
+        if (m_telemetry.on)
+        {
+            const Set::Scalar now = amrex::second();
+            m_telemetry.advance[lev] += now - start;
+            start = now;
+        }
+        FinishGhostExchange(lev, time);
+        if (m_telemetry.on)
+        {
+            const Set::Scalar now = amrex::second();
+            m_telemetry.fillpatch[lev] += now - start;
+            start = now;
+        }
+        if (split) AdvanceOverlap(lev, time, dt[lev], false);
+        else Advance(lev, time, dt[lev]);
+    }
+    else Advance(lev, time, dt[lev]);
     ++istep[lev];
+    if (m_telemetry.on) m_telemetry.advance[lev] += amrex::second() - start;
 
     if (Verbose() && amrex::ParallelDescriptor::IOProcessor())
     {
@@ -1144,10 +2543,12 @@ Integrator::TimeStep(int lev, amrex::Real time, int /*iteration*/)
 
         for (int n = 0; n < cell.number_of_fabs; n++)
         {
+            if (cell.piecewise_constant_array[n]) continue;
             amrex::average_down(*(*cell.fab_array[n])[lev + 1], *(*cell.fab_array[n])[lev],
                 geom[lev + 1], geom[lev],
                 0, (*cell.fab_array[n])[lev]->nComp(), refRatio(lev));
         }
+        RestrictPiecewiseConstant(lev);
         for (int n = 0; n < node.number_of_fabs; n++)
         {
             amrex::average_down(*(*node.fab_array[n])[lev + 1], *(*node.fab_array[n])[lev],
@@ -2,6 +2,7 @@
 #include <eigen3/Eigen/Eigenvalues>
 
 #include <cmath>
+#include <algorithm>
 
 #include <AMReX_SPACE.H>
 
@@ -34,230 +35,341 @@ void PhaseFieldMicrostructure<model_type>::Advance(int lev, Set::Scalar time, Se
     /// TODO Make this optional
     //if (lev != max_level) return;
     //std::swap(eta_old_mf[lev], eta_new_mf[lev]);
-    const Set::Scalar* DX = this->geom[lev].CellSize();
+    // In sparse mode, eta is stored as (grain, value) pairs in the slots of each
+    // cell, and only those are visited. Otherwise, every grain is visited and
+    // slot == grain index.
+    if (pf.sparse.on) UpdateActiveGrains(lev);
 
+    for (amrex::MFIter mfi(*Eta()[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Set::Scalar t0 = BoxCostTimer();
+        DrivingForce(lev, time, mfi, mfi.tilebox());
+        UpdateEta(lev, time, dt, mfi, mfi.tilebox());
+        AddBoxCost(lev, mfi, BoxCostTimer() - t0);
+    }
+    if (anisotropic_kinetics.on && time >= anisotropic_kinetics.tstart) UpdateEtaAnisotropic(lev, dt);
 
-    Model::Interface::GB::SH gbmodel(0.0, 0.0, anisotropy.sigma0, anisotropy.sigma1);
+    if (pf.sparse.on) ActiveGrainsChanged(lev);
+}
 
+template<class model_type>
+bool PhaseFieldMicrostructure<model_type>::AdvanceOverlap(int lev, Set::Scalar time, Set::Scalar dt, bool a_interior)
+{
+    // The active grain lists are rebuilt from the ghost cells before the update
+    if (pf.sparse.on) return false;
+    BL_PROFILE("PhaseFieldMicrostructure::AdvanceOverlap");
+
+    // Width of the stencils of the boundary term (the anisotropic one uses a 5^d neighborhood)
+    const int width = (anisotropy.on && time >= anisotropy.tstart) ? 2 : 1;
+
+    // Eta is only updated once its driving force is known everywhere, so the
+    // boundary strips computed after the exchange still see the old eta.
+    if (!a_interior) Base::Mechanics<model_type>::Advance(lev, time, dt);
     for (amrex::MFIter mfi(*eta_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
-        amrex::Box bx = mfi.tilebox();
-        //if (m_type == MechanicsBase<model_type>::Type::Static)
-        //bx.grow(number_of_ghost_cells-1);
-        //bx = bx & domain;
-        Set::Patch<Set::Scalar> eta = eta_mf.Patch(lev,mfi);
-        Set::Patch<Set::Scalar> driving_force = driving_force_mf.Patch(lev,mfi);
-        Set::Patch<Set::Scalar> driving_force_threshold = driving_force_threshold_mf.Patch(lev,mfi);// = (*driving_force_mf[lev]).array(mfi);
-
-        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
-        {
-            for (int m = 0; m < number_of_grains; m++)
-            {
-                driving_force(i, j, k, m) = 0.0;
-                if (pf.threshold.on) driving_force_threshold(i, j, k, m) = 0.0;
-                Set::Scalar kappa = NAN, mu = NAN;
+        Set::Scalar t0 = BoxCostTimer();
+        for (const amrex::Box& bx : OverlapBoxes(mfi, width, a_interior))
+            DrivingForce(lev, time, mfi, bx);
+        if (!a_interior) UpdateEta(lev, time, dt, mfi, mfi.tilebox());
+        AddBoxCost(lev, mfi, BoxCostTimer() - t0);
+    }
+    if (!a_interior && anisotropic_kinetics.on && time >= anisotropic_kinetics.tstart) UpdateEtaAnisotropic(lev, dt);
+    return true;
+}
 
-                //
-                // BOUNDARY TERM and SECOND ORDER REGULARIZATION
-                //
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::DrivingForce(int lev, Set::Scalar time, amrex::MFIter& mfi, const amrex::Box& bx)
+{
+    const Set::CellSize DX(this->geom[lev]);
+
+    // Kernels capture these copies rather than `this`
+    const auto pf = this->pf;
+    const auto lagrange = this->lagrange;
+    const auto anisotropy = this->anisotropy;
+    const Set::Scalar volume = this->volume;
+    Util::ErrorFlag::Handle nan_flag = this->nan_flag.Device();
+    // The tabulated GB energy can be used on the device; the model itself is host-only
+    const Model::Interface::GB::GB::Table gb = boundary ? boundary->Device() : Model::Interface::GB::GB::Table();
+#ifndef AMREX_USE_GPU
+    Model::Interface::GB::GB* const gbmodel = boundary;
+#endif
+    const int number_of_slots = pf.sparse.on ? pf.sparse.number_of_active_grains : number_of_grains;
 
-                Set::Vector Deta = Numeric::Gradient(eta, i, j, k, m, DX);
-                Set::Scalar normgrad = Deta.lpNorm<2>();
-                if (normgrad < 1E-4)
-                    continue; // This ought to speed things up.
+    Set::Patch<Set::Scalar> eta = Eta().Patch(lev,mfi);
+    Set::Patch<Set::Scalar> driving_force = driving_force_mf.Patch(lev,mfi);
+    Set::Patch<Set::Scalar> driving_force_threshold = driving_force_threshold_mf.Patch(lev,mfi);// = (*driving_force_mf[lev]).array(mfi);
+    Set::Patch<const Set::Scalar> active = active_mf.Patch(lev,mfi);
 
-                Set::Matrix DDeta = Numeric::Hessian(eta, i, j, k, m, DX);
-                Set::Scalar laplacian = DDeta.trace();
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+    {
+        for (int s = 0; s < number_of_slots; s++)
+        {
+            // m is the grain, and c the component of eta (and of the driving force) that holds it
+            const int m = pf.sparse.on ? (int)active(i, j, k, s) : s;
+            if (m < 0) break;
+            const int c = pf.sparse.on ? s : m;
+            auto grain = [=](int p, int q, int r) { return SlotValue(active, eta, p, q, r, number_of_slots, m); };
+
+            driving_force(i, j, k, c) = 0.0;
+            if (pf.threshold.on) driving_force_threshold(i, j, k, c) = 0.0;
+            Set::Scalar kappa = NAN, mu = NAN;
+
+            //
+            // BOUNDARY TERM and SECOND ORDER REGULARIZATION
+            //
+
+            Set::Vector Deta = pf.sparse.on ? Numeric::Neighborhood<1>(grain, i, j, k).Gradient(DX)
+                                            : Numeric::Gradient(eta, i, j, k, m, DX);
+            Set::Scalar normgrad = Deta.lpNorm<2>();
+            if (normgrad < 1E-4)
+                continue; // This ought to speed things up.
 
-                if (!anisotropy.on || time < anisotropy.tstart)
+            if (!anisotropy.on || time < anisotropy.tstart)
+            {
+                Set::Scalar laplacian = pf.sparse.on ? Numeric::Neighborhood<1>(grain, i, j, k).Laplacian(DX)
+                                                     : Numeric::Laplacian(eta, i, j, k, m, DX);
+                kappa = pf.l_gb * 0.75 * pf.sigma0;
+                mu = 0.75 * (1.0 / 0.23) * pf.sigma0 / pf.l_gb;
+                if (pf.threshold.boundary)  driving_force_threshold(i, j, k, c) += -kappa * laplacian;
+                else                        driving_force(i, j, k, c) += -kappa * laplacian;
+            }
+            else
+            {
+                // Load the 5^d neighborhood once for both the Hessian and double Hessian
+                Set::Matrix DDeta;
+                Set::Matrix4<AMREX_SPACEDIM, Set::Sym::Full> DDDDEta;
+                if (pf.sparse.on)
                 {
-                    kappa = pf.l_gb * 0.75 * pf.sigma0;
-                    mu = 0.75 * (1.0 / 0.23) * pf.sigma0 / pf.l_gb;
-                    if (pf.threshold.boundary)  driving_force_threshold(i, j, k, m) += -kappa * laplacian;
-                    else                        driving_force(i, j, k, m) += -kappa * laplacian;
+                    Numeric::Neighborhood<2> nbr(grain, i, j, k);
+                    DDeta = nbr.Hessian(DX);
+                    DDDDEta = nbr.DoubleHessian(DX);
                 }
                 else
                 {
-                    Set::Matrix4<AMREX_SPACEDIM, Set::Sym::Full> DDDDEta = Numeric::DoubleHessian<AMREX_SPACEDIM>(eta, i, j, k, m, DX);
-                    auto anisotropic_df = boundary->DrivingForce(Deta, DDeta, DDDDEta);
-                    if (pf.threshold.boundary) driving_force_threshold(i, j, k, m) += pf.l_gb * 0.75 * std::get<0>(anisotropic_df);
-                    else                       driving_force(i, j, k, m) += pf.l_gb * 0.75 * std::get<0>(anisotropic_df);
-                    if (std::isnan(std::get<0>(anisotropic_df))) Util::Abort(INFO);
-                    if (pf.threshold.boundary) driving_force_threshold(i, j, k, m) += anisotropy.beta * std::get<1>(anisotropic_df);
-                    else                       driving_force(i, j, k, m) += anisotropy.beta * std::get<1>(anisotropic_df);
-                    if (std::isnan(std::get<1>(anisotropic_df))) Util::Abort(INFO);
-                    mu = 0.75 * (1.0 / 0.23) * boundary->W(Deta) / pf.l_gb;
+                    Numeric::Neighborhood<2> nbr(eta, i, j, k, m);
+                    DDeta = nbr.Hessian(DX);
+                    DDDDEta = nbr.DoubleHessian(DX);
                 }
-
-                //
-                // CHEMICAL POTENTIAL
-                //
-
-                Set::Scalar sum_of_squares = 0.;
-                for (int n = 0; n < number_of_grains; n++)
+                amrex::GpuArray<Set::Scalar, 2> anisotropic_df;
+                Set::Scalar sigma;
+#ifndef AMREX_USE_GPU
+                if (!gb.on())
                 {
-                    if (m == n)
-                        continue;
-                    sum_of_squares += eta(i, j, k, n) * eta(i, j, k, n);
+                    std::tie(anisotropic_df[0], anisotropic_df[1]) = gbmodel->DrivingForce(Deta, DDeta, DDDDEta);
+                    sigma = gbmodel->W(Deta);
                 }
-                if (pf.threshold.chempot)
-                    driving_force_threshold(i, j, k, m) += mu * (eta(i, j, k, m) * eta(i, j, k, m) - 1.0 + 2.0 * pf.gamma * sum_of_squares) * eta(i, j, k, m);
                 else
-                    driving_force(i, j, k, m) += mu * (eta(i, j, k, m) * eta(i, j, k, m) - 1.0 + 2.0 * pf.gamma * sum_of_squares) * eta(i, j, k, m);
-
-                //
-                // SYNTHETIC DRIVING FORCE
-                //
-                if (lagrange.on && m == 0 && time > lagrange.tstart)
+#endif
                 {
-                    if (pf.threshold.lagrange)
-                        driving_force_threshold(i, j, k, m) += lagrange.lambda * (volume - lagrange.vol0);
-                    else
-                        driving_force(i, j, k, m) += lagrange.lambda * (volume - lagrange.vol0);
+                    anisotropic_df = gb.DrivingForce(Deta, DDeta, DDDDEta);
+                    sigma = gb.W(Deta);
                 }
+                if (pf.threshold.boundary) driving_force_threshold(i, j, k, c) += pf.l_gb * 0.75 * anisotropic_df[0];
+                else                       driving_force(i, j, k, c) += pf.l_gb * 0.75 * anisotropic_df[0];
+                if (std::isnan(anisotropic_df[0])) nan_flag.Raise(1, i, j, k);
+                if (pf.threshold.boundary) driving_force_threshold(i, j, k, c) += anisotropy.beta * anisotropic_df[1];
+                else                       driving_force(i, j, k, c) += anisotropy.beta * anisotropic_df[1];
+                if (std::isnan(anisotropic_df[1])) nan_flag.Raise(2, i, j, k);
+                mu = 0.75 * (1.0 / 0.23) * sigma / pf.l_gb;
             }
-        });
 
-        //
-        // ELASTIC DRIVING FORCE
-        //
-        if (pf.elastic_df)
-        {
-            amrex::Array4<const Set::Matrix> const& sigma = (*this->stress_mf[lev]).array(mfi);
+            //
+            // CHEMICAL POTENTIAL
+            //
 
-            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+            Set::Scalar sum_of_squares = 0.;
+            for (int t = 0; t < number_of_slots; t++)
             {
-                for (int m = 0; m < number_of_grains; m++)
-                {
-                    Set::Scalar etasum = 0.0;
-                    Set::Matrix F0avg = Set::Matrix::Zero();
+                if (pf.sparse.on && active(i, j, k, t) < 0) break;
+                if (c == t)
+                    continue;
+                sum_of_squares += eta(i, j, k, t) * eta(i, j, k, t);
+            }
+            if (pf.threshold.chempot)
+                driving_force_threshold(i, j, k, c) += mu * (eta(i, j, k, c) * eta(i, j, k, c) - 1.0 + 2.0 * pf.gamma * sum_of_squares) * eta(i, j, k, c);
+            else
+                driving_force(i, j, k, c) += mu * (eta(i, j, k, c) * eta(i, j, k, c) - 1.0 + 2.0 * pf.gamma * sum_of_squares) * eta(i, j, k, c);
 
-                    for (int n = 0; n < number_of_grains; n++)
-                    {
-                        etasum += eta(i, j, k, n);
-                        F0avg += eta(i, j, k, n) * mechanics.model[n].F0;
-                    }
+            //
+            // SYNTHETIC DRIVING FORCE
+            //
+            if (lagrange.on && m == 0 && time > lagrange.tstart)
+            {
+                if (pf.threshold.lagrange)
+                    driving_force_threshold(i, j, k, c) += lagrange.lambda * (volume - lagrange.vol0);
+                else
+                    driving_force(i, j, k, c) += lagrange.lambda * (volume - lagrange.vol0);
+            }
+        }
+    });
+
+}
 
-                    Set::Matrix sig = Numeric::Interpolate::NodeToCellAverage(sigma, i, j, k, 0);
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::UpdateEta(int lev, Set::Scalar time, Set::Scalar dt, amrex::MFIter& mfi, const amrex::Box& bx)
+{
+    // Kernels capture these copies rather than `this`
+    const auto pf = this->pf;
+    const int number_of_slots = pf.sparse.on ? pf.sparse.number_of_active_grains : number_of_grains;
+    const model_type* models = pf.elastic_df ? GrainModels() : nullptr;
 
-                    //Set::Matrix dF0deta = mechanics.model[m].F0;//(etasum * elastic.model[m].F0 - F0avg) / (etasum * etasum);
-                    Set::Matrix dF0deta = Set::Matrix::Zero();
+    // Components of eta and the driving force are slots in sparse mode, and grains otherwise
+    Set::Patch<Set::Scalar> eta = Eta().Patch(lev,mfi);
+    Set::Patch<Set::Scalar> driving_force = driving_force_mf.Patch(lev,mfi);
+    Set::Patch<Set::Scalar> driving_force_threshold = driving_force_threshold_mf.Patch(lev,mfi);
+    Set::Patch<const Set::Scalar> active = active_mf.Patch(lev,mfi);
 
-                    for (int n = 0; n < number_of_grains; n++)
-                    {
-                        if (n == m) continue;
-                        Set::Scalar normsq = eta(i, j, k, m) * eta(i, j, k, m) + eta(i, j, k, n) * eta(i, j, k, n);
-                        dF0deta += (2.0 * eta(i, j, k, m) * eta(i, j, k, n) * eta(i, j, k, n) * (mechanics.model[m].F0 - mechanics.model[n].F0))
-                            / normsq / normsq;
-                    }
+    //
+    // ELASTIC DRIVING FORCE
+    //
+    if (pf.elastic_df)
+    {
+        const Set::SoAPatch<Set::Matrix> sigma = this->stress_mf.Patch(lev, mfi);
 
-                    Set::Scalar tmpdf = (dF0deta.transpose() * sig).trace();
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            for (int s = 0; s < number_of_slots; s++)
+            {
+                const int m = pf.sparse.on ? (int)active(i, j, k, s) : s;
+                if (m < 0) break;
 
-                    if (pf.threshold.mechanics)
-                        driving_force_threshold(i, j, k, m) -= pf.elastic_mult * tmpdf;
-                    else
-                        driving_force(i, j, k, m) -= pf.elastic_mult * tmpdf;
+                Set::Scalar etasum = 0.0;
+                Set::Matrix F0avg = Set::Matrix::Zero();
+
+                for (int t = 0; t < number_of_slots; t++)
+                {
+                    const int n = pf.sparse.on ? (int)active(i, j, k, t) : t;
+                    if (n < 0) break;
+                    etasum += eta(i, j, k, t);
+                    F0avg += eta(i, j, k, t) * models[n].F0;
                 }
-            });
-        }
 
+                Set::Matrix sig = Numeric::Interpolate::NodeToCellAverage(sigma, i, j, k, 0);
+
+                //Set::Matrix dF0deta = mechanics.model[m].F0;//(etasum * elastic.model[m].F0 - F0avg) / (etasum * etasum);
+                Set::Matrix dF0deta = Set::Matrix::Zero();
+
+                for (int t = 0; t < number_of_slots; t++)
+                {
+                    const int n = pf.sparse.on ? (int)active(i, j, k, t) : t;
+                    if (n < 0) break;
+                    if (n == m) continue;
+                    Set::Scalar normsq = eta(i, j, k, s) * eta(i, j, k, s) + eta(i, j, k, t) * eta(i, j, k, t);
+                    dF0deta += (2.0 * eta(i, j, k, s) * eta(i, j, k, t) * eta(i, j, k, t) * (models[m].F0 - models[n].F0))
+                        / normsq / normsq;
+                }
 
-        //
-        // Update eta
-        // (if NOT using anisotropic kinetics)
-        //
-        
-        if (!anisotropic_kinetics.on || time < anisotropic_kinetics.tstart)
+                Set::Scalar tmpdf = (dF0deta.transpose() * sig).trace();
+
+                if (pf.threshold.mechanics)
+                    driving_force_threshold(i, j, k, s) -= pf.elastic_mult * tmpdf;
+                else
+                    driving_force(i, j, k, s) -= pf.elastic_mult * tmpdf;
+            }
+        });
+    }
+
+
+    //
+    // Update eta
+    // (if NOT using anisotropic kinetics)
+    //
+
+    if (!anisotropic_kinetics.on || time < anisotropic_kinetics.tstart)
+    {
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
         {
-            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+            for (int s = 0; s < number_of_slots; s++)
             {
-                for (int m = 0; m < number_of_grains; m++)
+                if (pf.sparse.on && active(i, j, k, s) < 0) break;
+
+                if (pf.threshold.on)
                 {
-                    if (pf.threshold.on)
+                    if (driving_force_threshold(i, j, k, s) > pf.threshold.value)
                     {
-                        if (driving_force_threshold(i, j, k, m) > pf.threshold.value)
-                        {
-                            if (pf.threshold.type == ThresholdType::Continuous)
-                                eta(i, j, k, m) -= pf.L * dt * (driving_force_threshold(i, j, k, m) - pf.threshold.value);
-                            else if (pf.threshold.type == ThresholdType::Chop)
-                                eta(i, j, k, m) -= pf.L * dt * (driving_force_threshold(i, j, k, m));
-                        }
-                        else if (driving_force_threshold(i, j, k, m) < -pf.threshold.value)
-                        {
-                            if (pf.threshold.type == ThresholdType::Continuous)
-                                eta(i, j, k, m) -= pf.L * dt * (driving_force_threshold(i, j, k, m) + pf.threshold.value);
-                            else if (pf.threshold.type == ThresholdType::Chop)
-                                eta(i, j, k, m) -= pf.L * dt * (driving_force_threshold(i, j, k, m));
-                        }
+                        if (pf.threshold.type == ThresholdType::Continuous)
+                            eta(i, j, k, s) -= pf.L * dt * (driving_force_threshold(i, j, k, s) - pf.threshold.value);
+                        else if (pf.threshold.type == ThresholdType::Chop)
+                            eta(i, j, k, s) -= pf.L * dt * (driving_force_threshold(i, j, k, s));
+                    }
+                    else if (driving_force_threshold(i, j, k, s) < -pf.threshold.value)
+                    {
+                        if (pf.threshold.type == ThresholdType::Continuous)
+                            eta(i, j, k, s) -= pf.L * dt * (driving_force_threshold(i, j, k, s) + pf.threshold.value);
+                        else if (pf.threshold.type == ThresholdType::Chop)
+                            eta(i, j, k, s) -= pf.L * dt * (driving_force_threshold(i, j, k, s));
                     }
-
-                    eta(i, j, k, m) -= pf.L * dt * driving_force(i, j, k, m);
                 }
-            });
-        }
+
+                eta(i, j, k, s) -= pf.L * dt * driving_force(i, j, k, s);
+            }
+        });
     }
+}
+
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::UpdateEtaAnisotropic(int lev, Set::Scalar dt)
+{
+    const Set::CellSize DX(this->geom[lev]);
+    const auto pf = this->pf;
 
     //
     // Update eta
-    // (if we ARE using anisotropic kinetics)
+    // (if we ARE using anisotropic kinetics; not available in sparse mode)
     //
-    
-    if (anisotropic_kinetics.on && time >= anisotropic_kinetics.tstart)
+    for (amrex::MFIter mfi(*eta_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
-        for (amrex::MFIter mfi(*eta_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-            amrex::Box bx = mfi.tilebox();
-            amrex::Array4<const Set::Scalar> const& eta = (*eta_mf[lev]).array(mfi);
-            amrex::Array4<Set::Scalar> const& L = (*anisotropic_kinetics.L_mf[lev]).array(mfi);
-            amrex::Array4<Set::Scalar> const& threshold = (*anisotropic_kinetics.threshold_mf[lev]).array(mfi);
+        amrex::Box bx = mfi.tilebox();
+        amrex::Array4<const Set::Scalar> const& eta = (*eta_mf[lev]).array(mfi);
+        amrex::Array4<Set::Scalar> const& L = (*anisotropic_kinetics.L_mf[lev]).array(mfi);
+        amrex::Array4<Set::Scalar> const& threshold = (*anisotropic_kinetics.threshold_mf[lev]).array(mfi);
 
-            for (int m = 0; m < number_of_grains; m++)
+        for (int m = 0; m < number_of_grains; m++)
+        {
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
             {
-                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
-                {
-                    Set::Vector Deta = Numeric::Gradient(eta, i, j, k, m, DX);
-                    Set::Scalar theta = atan2(Deta(1), Deta(0));
-                    L(i, j, k, m) = (4. / 3.) * anisotropic_kinetics.mobility(theta) / pf.l_gb;
-                    threshold(i, j, k, m) = anisotropic_kinetics.threshold(theta);
-                });
-            }
+                Set::Vector Deta = Numeric::Gradient(eta, i, j, k, m, DX);
+                Set::Scalar theta = atan2(Deta(1), Deta(0));
+                L(i, j, k, m) = (4. / 3.) * anisotropic_kinetics.mobility(theta) / pf.l_gb;
+                threshold(i, j, k, m) = anisotropic_kinetics.threshold(theta);
+            });
         }
-        
-        for (amrex::MFIter mfi(*eta_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-            amrex::Box bx = mfi.tilebox();
-            Set::Patch<Set::Scalar>       eta = eta_mf.Patch(lev,mfi);
-            Set::Patch<const Set::Scalar> driving_force = driving_force_mf.Patch(lev,mfi);
-            Set::Patch<const Set::Scalar> driving_force_threshold = driving_force_threshold_mf.Patch(lev,mfi);
-            Set::Patch<const Set::Scalar> L = anisotropic_kinetics.L_mf.Patch(lev,mfi);
-            Set::Patch<const Set::Scalar> threshold = anisotropic_kinetics.threshold_mf.Patch(lev,mfi);
+    }
 
-            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+    for (amrex::MFIter mfi(*eta_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        amrex::Box bx = mfi.tilebox();
+        Set::Patch<Set::Scalar>       eta = eta_mf.Patch(lev,mfi);
+        Set::Patch<const Set::Scalar> driving_force = driving_force_mf.Patch(lev,mfi);
+        Set::Patch<const Set::Scalar> driving_force_threshold = driving_force_threshold_mf.Patch(lev,mfi);
+        Set::Patch<const Set::Scalar> L = anisotropic_kinetics.L_mf.Patch(lev,mfi);
+        Set::Patch<const Set::Scalar> threshold = anisotropic_kinetics.threshold_mf.Patch(lev,mfi);
+
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            for (int m = 0; m < number_of_grains; m++)
             {
-                for (int m = 0; m < number_of_grains; m++)
+                if (pf.threshold.on)
                 {
-                    if (pf.threshold.on)
+                    if (driving_force_threshold(i, j, k, m) > threshold(i,j,k,m))
                     {
-                        if (driving_force_threshold(i, j, k, m) > threshold(i,j,k,m))
-                        {
-                            if (pf.threshold.type == ThresholdType::Continuous)
-                                eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m) - threshold(i,j,k,m));
-                            else if (pf.threshold.type == ThresholdType::Chop)
-                                eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m));
-                        }
-                        else if (driving_force_threshold(i, j, k, m) < -pf.threshold.value)
-                        {
-                            if (pf.threshold.type == ThresholdType::Continuous)
-                                eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m) + threshold(i,j,k,m));
-                            else if (pf.threshold.type == ThresholdType::Chop)
-                                eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m));
-                        }
+                        if (pf.threshold.type == ThresholdType::Continuous)
+                            eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m) - threshold(i,j,k,m));
+                        else if (pf.threshold.type == ThresholdType::Chop)
+                            eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m));
+                    }
+                    else if (driving_force_threshold(i, j, k, m) < -pf.threshold.value)
+                    {
+                        if (pf.threshold.type == ThresholdType::Continuous)
+                            eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m) + threshold(i,j,k,m));
+                        else if (pf.threshold.type == ThresholdType::Chop)
+                            eta(i, j, k, m) -= L(i,j,k,m) * dt * (driving_force_threshold(i, j, k, m));
                     }
-
-                    eta(i, j, k, m) -= L(i,j,k,m) * dt * driving_force(i, j, k, m);
                 }
-            });
-        }        
+
+                eta(i, j, k, m) -= L(i,j,k,m) * dt * driving_force(i, j, k, m);
+            }
+        });
     }
 }
 
@@ -266,8 +378,215 @@ void PhaseFieldMicrostructure<model_type>::Initialize(int lev)
 {
     BL_PROFILE("PhaseFieldMicrostructure::Initialize");
     Base::Mechanics<model_type>::Initialize(lev);
-    ic->Initialize(lev, eta_mf);
-    ic->Initialize(lev, eta_mf);
+    if (!pf.sparse.on)
+    {
+        ic->Initialize(lev, eta_mf);
+        ic->Initialize(lev, eta_mf);
+        return;
+    }
+
+    // The initial condition is evaluated for every grain on a temporary field of
+    // this level only, which is compressed into the slots of each cell and freed.
+    const int number_of_slots = pf.sparse.number_of_active_grains;
+    const Set::Scalar threshold = pf.sparse.threshold;
+    Set::Field<Set::Scalar> dense(lev + 1);
+    dense[lev].reset(new amrex::MultiFab(active_mf[lev]->boxArray(), active_mf[lev]->DistributionMap(),
+                                         number_of_grains, active_mf[lev]->nGrow() + 1));
+    ic->Initialize(lev, dense);
+    dense[lev]->FillBoundary(this->geom[lev].periodicity());
+
+    for (amrex::MFIter mfi(*active_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box bx = mfi.growntilebox();
+        amrex::Array4<const Set::Scalar> const& eta = dense[lev]->const_array(mfi);
+        amrex::Array4<Set::Scalar> const& active = active_mf[lev]->array(mfi);
+        amrex::Array4<Set::Scalar> const& active_eta = active_eta_mf[lev]->array(mfi);
+
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            // Significance of a grain is its largest value over the cell and its
+            // face neighbors, so that grains about to sweep into the cell are kept.
+            int idx[max_active_grains];
+            Set::Scalar score[max_active_grains];
+            int nactive = 0;
+            for (int n = 0; n < number_of_grains; n++)
+            {
+                Set::Scalar val = eta(i, j, k, n);
+                AMREX_D_TERM(val = std::max(val, std::max(eta(i - 1, j, k, n), eta(i + 1, j, k, n)));,
+                             val = std::max(val, std::max(eta(i, j - 1, k, n), eta(i, j + 1, k, n)));,
+                             val = std::max(val, std::max(eta(i, j, k - 1, n), eta(i, j, k + 1, n))););
+                if (val >= threshold) Insert(idx, score, nactive, number_of_slots, n, val);
+            }
+            for (int s = 0; s < number_of_slots; s++)
+            {
+                active(i, j, k, s) = (s < nactive) ? (Set::Scalar)idx[s] : -1.0;
+                active_eta(i, j, k, s) = (s < nactive) ? eta(i, j, k, idx[s]) : 0.0;
+            }
+        });
+    }
+
+    if (lev >= (int)active_current.size()) active_current.resize(lev + 1, 0);
+    active_current[lev] = 1;
+}
+
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::Regrid(int lev, Set::Scalar time)
+{
+    Base::Mechanics<model_type>::Regrid(lev, time);
+    if (pf.sparse.on) ActiveGrainsChanged(lev);
+}
+
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::RestrictPiecewiseConstant(int lev)
+{
+    if (!pf.sparse.on) return;
+    BL_PROFILE("PhaseFieldMicrostructure::RestrictPiecewiseConstant");
+    const int number_of_slots = pf.sparse.number_of_active_grains;
+    const amrex::IntVect ratio = this->refRatio(lev);
+    const Set::Scalar fac = 1.0 / (Set::Scalar)AMREX_D_TERM(ratio[0], *ratio[1], *ratio[2]);
+
+    // Each coarse cell keeps the grains with the largest average over its fine
+    // cells, computed on the coarsened fine grids and then copied to this level.
+    const amrex::BoxArray cba = amrex::coarsen(active_mf[lev + 1]->boxArray(), ratio);
+    const amrex::DistributionMapping& dm = active_mf[lev + 1]->DistributionMap();
+    amrex::MultiFab crse_active(cba, dm, number_of_slots, 0), crse_eta(cba, dm, number_of_slots, 0);
+
+    for (amrex::MFIter mfi(crse_active, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<const Set::Scalar> const& fine = active_mf[lev + 1]->const_array(mfi);
+        amrex::Array4<const Set::Scalar> const& fine_eta = active_eta_mf[lev + 1]->const_array(mfi);
+        amrex::Array4<Set::Scalar> const& active = crse_active.array(mfi);
+        amrex::Array4<Set::Scalar> const& active_eta = crse_eta.array(mfi);
+
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            int grains[max_node_grains];
+            Set::Scalar avg[max_node_grains];
+            int ngrains = 0;
+            for (int r = 0; r < AMREX_D_PICK(1, 1, ratio[2]); r++)
+            for (int q = 0; q < AMREX_D_PICK(1, ratio[1], ratio[1]); q++)
+            for (int p = 0; p < ratio[0]; p++)
+            {
+                const int ii = i * ratio[0] + p;
+                const int jj = AMREX_D_PICK(j, j * ratio[1] + q, j * ratio[1] + q);
+                const int kk = AMREX_D_PICK(k, k, k * ratio[2] + r);
+                for (int s = 0; s < number_of_slots; s++)
+                {
+                    const int n = (int)fine(ii, jj, kk, s);
+                    if (n < 0) break;
+                    int g = 0;
+                    while (g < ngrains && grains[g] != n) g++;
+                    if (g == max_node_grains) continue; // only with refinement ratios above 2
+                    if (g == ngrains) { grains[ngrains] = n; avg[ngrains++] = 0.0; }
+                    avg[g] += fac * fine_eta(ii, jj, kk, s);
+                }
+            }
+
+            int idx[max_active_grains];
+            Set::Scalar score[max_active_grains];
+            int nactive = 0;
+            for (int g = 0; g < ngrains; g++)
+                if (avg[g] > 0.0) Insert(idx, score, nactive, number_of_slots, grains[g], avg[g]);
+            for (int s = 0; s < number_of_slots; s++)
+            {
+                active(i, j, k, s) = (s < nactive) ? (Set::Scalar)idx[s] : -1.0;
+                active_eta(i, j, k, s) = (s < nactive) ? score[s] : 0.0;
+            }
+        });
+    }
+
+    active_mf[lev]->ParallelCopy(crse_active, 0, 0, number_of_slots);
+    active_eta_mf[lev]->ParallelCopy(crse_eta, 0, 0, number_of_slots);
+    ActiveGrainsChanged(lev);
+}
+
+template<class model_type>
+const model_type* PhaseFieldMicrostructure<model_type>::GrainModels()
+{
+    // The models are not trivially copyable, so they are staged through a pinned
+    // BaseFab (one entry per grain) rather than a Gpu::DeviceVector.
+    if (!grain_models)
+    {
+        const amrex::Box bx(amrex::IntVect::TheZeroVector(), amrex::IntVect(AMREX_D_DECL(number_of_grains - 1, 0, 0)));
+        amrex::BaseFab<model_type> host(bx, 1, amrex::The_Pinned_Arena());
+        for (int n = 0; n < number_of_grains; n++) host.dataPtr()[n] = mechanics.model[n];
+        grain_models.reset(new amrex::BaseFab<model_type>(bx, 1, amrex::The_Arena()));
+        amrex::Gpu::htod_memcpy(grain_models->dataPtr(), host.dataPtr(), host.nBytes());
+    }
+    return grain_models->dataPtr();
+}
+
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::UpdateActiveGrains(int lev)
+{
+    if (lev < (int)active_current.size() && active_current[lev]) return;
+    BL_PROFILE("PhaseFieldMicrostructure::UpdateActiveGrains");
+    const int number_of_slots = pf.sparse.number_of_active_grains;
+    const Set::Scalar threshold = pf.sparse.threshold;
+
+    amrex::MultiFab new_active(active_mf[lev]->boxArray(), active_mf[lev]->DistributionMap(), number_of_slots, 0);
+    amrex::MultiFab new_eta(active_mf[lev]->boxArray(), active_mf[lev]->DistributionMap(), number_of_slots, 0);
+
+    for (amrex::MFIter mfi(*active_mf[lev], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const amrex::Box& bx = mfi.tilebox();
+        amrex::Array4<const Set::Scalar> const& active = active_mf[lev]->const_array(mfi);
+        amrex::Array4<const Set::Scalar> const& eta = active_eta_mf[lev]->const_array(mfi);
+        amrex::Array4<Set::Scalar> const& active_new = new_active.array(mfi);
+        amrex::Array4<Set::Scalar> const& eta_new = new_eta.array(mfi);
+
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            // The candidates are the grains held by the cell or one of its face
+            // neighbors; as in Initialize, the significance of a grain is its
+            // largest value over these cells.
+            constexpr int ncells = 2 * AMREX_SPACEDIM + 1;
+            const amrex::IntVect cells[ncells] = {
+                amrex::IntVect(AMREX_D_DECL(i, j, k)),
+                AMREX_D_DECL(amrex::IntVect(AMREX_D_DECL(i - 1, j, k)), amrex::IntVect(AMREX_D_DECL(i, j - 1, k)), amrex::IntVect(AMREX_D_DECL(i, j, k - 1))),
+                AMREX_D_DECL(amrex::IntVect(AMREX_D_DECL(i + 1, j, k)), amrex::IntVect(AMREX_D_DECL(i, j + 1, k)), amrex::IntVect(AMREX_D_DECL(i, j, k + 1)))};
+
+            int idx[max_active_grains];
+            Set::Scalar score[max_active_grains];
+            int nactive = 0;
+            for (int c = 0; c < ncells; c++)
+            for (int s = 0; s < number_of_slots; s++)
+            {
+                const int n = (int)active(cells[c], s);
+                if (n < 0) break;
+                bool found = false;
+                for (int t = 0; t < nactive; t++) found = found || (idx[t] == n);
+                if (found) continue;
+
+                Set::Scalar val = 0.0;
+                for (int d = 0; d < ncells; d++)
+                {
+                    const amrex::Dim3 p = cells[d].dim3();
+                    val = std::max(val, SlotValue(active, eta, p.x, p.y, p.z, number_of_slots, n));
+                }
+                if (val >= threshold) Insert(idx, score, nactive, number_of_slots, n, val);
+            }
+            for (int s = 0; s < number_of_slots; s++)
+            {
+                active_new(i, j, k, s) = (s < nactive) ? (Set::Scalar)idx[s] : -1.0;
+                eta_new(i, j, k, s) = (s < nactive) ? SlotValue(active, eta, i, j, k, number_of_slots, idx[s]) : 0.0;
+            }
+        });
+    }
+
+    amrex::MultiFab::Copy(*active_mf[lev], new_active, 0, 0, number_of_slots, 0);
+    amrex::MultiFab::Copy(*active_eta_mf[lev], new_eta, 0, 0, number_of_slots, 0);
+
+    // Ghost cells shared with another box (or a periodic image) get the new lists.
+    // The rest keep the lists they were filled with, which hold the same values up
+    // to the grains dropped here (all below pf.sparse.threshold): a grain enters
+    // a list with value zero.
+    active_mf[lev]->FillBoundary(this->geom[lev].periodicity());
+    active_eta_mf[lev]->FillBoundary(this->geom[lev].periodicity());
+
+    if (lev >= (int)active_current.size()) active_current.resize(lev + 1, 0);
+    active_current[lev] = 1;
 }
 
 template<class model_type>
@@ -279,6 +598,35 @@ void PhaseFieldMicrostructure<model_type>::TagCellsForRefinement(int lev, amrex:
     const Set::Vector dx(DX);
     const Set::Scalar dxnorm = dx.lpNorm<2>();
 
+    if (pf.sparse.on)
+    {
+        UpdateActiveGrains(lev);
+        const int number_of_slots = pf.sparse.number_of_active_grains;
+        for (amrex::MFIter mfi(*active_mf[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const amrex::Box& bx = mfi.tilebox();
+            amrex::Array4<const amrex::Real> const& etanew = (*active_eta_mf[lev]).array(mfi);
+            amrex::Array4<const amrex::Real> const& active = (*active_mf[lev]).array(mfi);
+            amrex::Array4<char> const& tags = a_tags.array(mfi);
+
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                for (int s = 0; s < number_of_slots; s++)
+                {
+                    const int n = (int)active(i, j, k, s);
+                    if (n < 0) break;
+                    auto grain = [=](int p, int q, int r) { return SlotValue(active, etanew, p, q, r, number_of_slots, n); };
+                    Set::Vector grad = Numeric::Neighborhood<1>(grain, i, j, k).Gradient(DX);
+                    if (dxnorm * grad.lpNorm<2>() > ref_threshold)
+                    {
+                        tags(i, j, k) = amrex::TagBox::SET;
+                        break;
+                    }
+                }
+            });
+        }
+        return;
+    }
+
     for (amrex::MFIter mfi(*eta_mf[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const amrex::Box& bx = mfi.tilebox();
@@ -298,7 +646,8 @@ void PhaseFieldMicrostructure<model_type>::TagCellsForRefinement(int lev, amrex:
 template<class model_type>
 void PhaseFieldMicrostructure<model_type>::TimeStepComplete(Set::Scalar /*time*/, int /*iter*/)
 {
-    // TODO: remove this function, it is no longer needed.
+    nan_flag.Check(INFO, {"anisotropic boundary driving force is nan",
+                          "anisotropic regularization driving force is nan"});
 }
 
 template<class model_type>
@@ -312,29 +661,164 @@ void PhaseFieldMicrostructure<model_type>::UpdateModel(int a_step, Set::Scalar /
         amrex::Box domain = this->geom[lev].Domain();
         domain.convert(amrex::IntVect::TheNodeVector());
 
-        eta_mf[lev]->FillBoundary();
+        if (pf.sparse.on)
+        {
+            UpdateActiveGrains(lev);
+            active_mf[lev]->FillBoundary();
+            active_eta_mf[lev]->FillBoundary();
+        }
+        else eta_mf[lev]->FillBoundary();
+
+        // Only the boxes in which eta has changed need to be rebuilt
+        bool changed = true;
+        const std::vector<bool> dirty = pf.sparse.on ?
+            this->DirtyModel(lev, {active_mf[lev].get(), active_eta_mf[lev].get()}, changed) :
+            this->DirtyModel(lev, {eta_mf[lev].get()}, changed);
 
         for (MFIter mfi(*this->model_mf[lev], false); mfi.isValid(); ++mfi)
         {
+            if (!dirty[mfi.LocalIndex()]) continue;
             amrex::Box bx = mfi.grownnodaltilebox() & domain;
 
             amrex::Array4<model_type> const& model = this->model_mf[lev]->array(mfi);
-            amrex::Array4<const Set::Scalar> const& eta = eta_mf[lev]->array(mfi);
 
+            if (pf.sparse.on)
+            {
+                // Only the grains that are active in one of the cells surrounding
+                // the node contribute to the mixture.
+                amrex::Array4<const Set::Scalar> const& active = active_mf[lev]->array(mfi);
+                amrex::Array4<const Set::Scalar> const& eta = active_eta_mf[lev]->array(mfi);
+                const int number_of_slots = pf.sparse.number_of_active_grains;
+                const int ngrains_total = number_of_grains;
+                const model_type* models = GrainModels();
+                // Outermost ghost nodes use the nearest cell that has a list; they
+                // are overwritten by the boundary fill below wherever it reaches.
+                const amrex::Box cbx = amrex::grow(amrex::enclosedCells(mfi.validbox()), active_mf[lev]->nGrow());
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+                {
+                    amrex::GpuArray<int, max_node_grains> grains;
+                    amrex::GpuArray<Set::Scalar, max_node_grains> etas;
+                    int ngrains = 0;
+                    for (int p = i - 1; p <= i; p++)
+                    for (int q = j - (AMREX_SPACEDIM > 1); q <= j; q++)
+                    for (int r = k - (AMREX_SPACEDIM > 2); r <= k; r++)
+                    {
+                        const int pp = amrex::max(cbx.smallEnd(0), amrex::min(cbx.bigEnd(0), p));
+                        const int qq = amrex::max(cbx.smallEnd(1), amrex::min(cbx.bigEnd(1), q));
+#if AMREX_SPACEDIM > 2
+                        const int rr = amrex::max(cbx.smallEnd(2), amrex::min(cbx.bigEnd(2), r));
+#else
+                        const int rr = r;
+#endif
+                        for (int s = 0; s < number_of_slots; s++)
+                        {
+                            const int n = (int)active(pp, qq, rr, s);
+                            if (n < 0) break;
+                            int g = 0;
+                            while (g < ngrains && grains[g] != n) g++;
+                            if (g == ngrains) { grains[ngrains] = n; etas[ngrains++] = 0.0; }
+                            // Average of the grain over the cells around the node
+                            etas[g] += Numeric::Interpolate::fac * eta(pp, qq, rr, s);
+                        }
+                    }
+
+                    // Same weighting as model_type::Combine
+                    Set::Scalar etasum = 0.0;
+                    for (int g = 0; g < ngrains; g++) etasum += etas[g];
+                    model_type mix = model_type::Zero();
+                    if (ngrains == 0 || etasum <= 0.0)
+                    {
+                        // Nothing active here: mix all grains evenly
+                        for (int n = 0; n < ngrains_total; n++) mix += models[n] * (1.0 / ngrains_total);
+                    }
+                    else
+                    {
+                        for (int g = 0; g < ngrains; g++)
+                            mix += models[grains[g]] * (etas[g] / etasum);
+                    }
+                    model(i, j, k) = mix;
+                });
+                continue;
+            }
+
+            // Same weighting as model_type::Combine, accumulated in one pass over
+            // the grains, and with the same fallback as UpdateMixture where no
+            // grain is present.
+            amrex::Array4<const Set::Scalar> const& eta = eta_mf[lev]->array(mfi);
+            const int ngrains_total = number_of_grains;
+            const model_type* models = GrainModels();
             amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
             {
-                std::vector<Set::Scalar> etas(number_of_grains);
-                for (int n = 0; n < number_of_grains; n++)
-                    etas[n] = Numeric::Interpolate::CellToNodeAverage(eta, i, j, k, n);
-                model(i, j, k) = model_type::Combine(mechanics.model, etas);
+                model_type mix = model_type::Zero();
+                Set::Scalar etasum = 0.0;
+                for (int n = 0; n < ngrains_total; n++)
+                {
+                    const Set::Scalar etan = Numeric::Interpolate::CellToNodeAverage(eta, i, j, k, n);
+                    mix += models[n] * etan;
+                    etasum += etan;
+                }
+                if (etasum > 1E-12) model(i, j, k) = mix * (1.0 / etasum);
+                else
+                {
+                    mix = model_type::Zero();
+                    for (int n = 0; n < ngrains_total; n++) mix += models[n] * (1.0 / ngrains_total);
+                    model(i, j, k) = mix;
+                }
             });
         }
 
-        Util::RealFillBoundary(*this->model_mf[lev], this->geom[lev]);
+        if (changed) Util::RealFillBoundary(*this->model_mf[lev], this->geom[lev]);
     }
 
 }
 
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::MixtureTable(amrex::Vector<Set::Matrix4<AMREX_SPACEDIM, model_type::sym>>& a_table)
+{
+    // The mixture weights have one component per grain, which sparse mode avoids
+    // storing, so mechanics.compressed is not supported there.
+    if (pf.sparse.on) return;
+    a_table.resize(number_of_grains);
+    for (int n = 0; n < number_of_grains; n++)
+        a_table[n] = mechanics.model[n].DDW(Set::Matrix::Zero());
+}
+
+template<class model_type>
+void PhaseFieldMicrostructure<model_type>::UpdateMixture(int lev, amrex::MultiFab& a_weights)
+{
+    BL_PROFILE("PhaseFieldMicrostructure::UpdateMixture");
+
+    amrex::Box domain = this->geom[lev].Domain();
+    domain.convert(amrex::IntVect::TheNodeVector());
+
+    eta_mf[lev]->FillBoundary();
+
+    for (MFIter mfi(a_weights, false); mfi.isValid(); ++mfi)
+    {
+        amrex::Box bx = mfi.grownnodaltilebox() & domain;
+
+        amrex::Array4<Set::Scalar> const& w = a_weights.array(mfi);
+        amrex::Array4<const Set::Scalar> const& eta = eta_mf[lev]->array(mfi);
+
+        // Same weighting as model_type::Combine in UpdateModel
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
+        {
+            Set::Scalar etasum = 0.0;
+            for (int n = 0; n < number_of_grains; n++)
+            {
+                w(i, j, k, n) = Numeric::Interpolate::CellToNodeAverage(eta, i, j, k, n);
+                etasum += w(i, j, k, n);
+            }
+            // Where no grain is present (e.g. a void), mix the grains evenly
+            // rather than dividing by zero
+            if (etasum > 1E-12)
+                for (int n = 0; n < number_of_grains; n++) w(i, j, k, n) /= etasum;
+            else
+                for (int n = 0; n < number_of_grains; n++) w(i, j, k, n) = 1.0 / (Set::Scalar)number_of_grains;
+        });
+    }
+}
+
 template<class model_type>
 void PhaseFieldMicrostructure<model_type>::TimeStepBegin(Set::Scalar time, int iter)
 {
@@ -356,54 +840,68 @@ void PhaseFieldMicrostructure<model_type>::Integrate(int amrlev, Set::Scalar tim
     BL_PROFILE("PhaseFieldMicrostructure::Integrate");
     Base::Mechanics<model_type>::Integrate(amrlev, time, step, mfi, box);
 
-    Model::Interface::GB::SH gbmodel(0.0, 0.0, anisotropy.sigma0, anisotropy.sigma1);
-    const amrex::Real* DX = this->geom[amrlev].CellSize();
+    const Set::CellSize DX(this->geom[amrlev]);
     Set::Scalar dv = AMREX_D_TERM(DX[0], *DX[1], *DX[2]);
 
-    amrex::Array4<amrex::Real> const& eta = (*eta_mf[amrlev]).array(mfi);
-    amrex::ParallelFor(box, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // Kernels capture these copies rather than `this`
+    const auto pf = this->pf;
+    const auto anisotropy = this->anisotropy;
+    const bool isotropic = !anisotropy.on || time < anisotropy.tstart;
+    const Model::Interface::GB::GB::Table gb = boundary ? boundary->Device() : Model::Interface::GB::GB::Table();
+#ifndef AMREX_USE_GPU
+    Model::Interface::GB::GB* const gbmodel = boundary;
+#endif
+
+    // Only the first grain is integrated; in sparse mode it is looked up in the slots
+    const bool sparse = pf.sparse.on;
+    const int number_of_slots = pf.sparse.number_of_active_grains;
+    amrex::Array4<amrex::Real> const& eta = (*Eta()[amrlev]).array(mfi);
+    amrex::Array4<const amrex::Real> active = sparse ? active_mf[amrlev]->const_array(mfi) : amrex::Array4<const amrex::Real>();
+    this->template ThermoSum<5>(box, {&volume, &area, &gbenergy, &realgbenergy, &regenergy},
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) -> amrex::GpuArray<Set::Scalar, 5>
+    {
 #if AMREX_SPACEDIM == 2
         auto sten = Numeric::GetStencil(i, j, k, box);
 #endif
+        auto grain = [=](int p, int q, int r) { return SlotValue(active, eta, p, q, r, number_of_slots, 0); };
 
-        volume += eta(i, j, k, 0) * dv;
+        amrex::GpuArray<Set::Scalar, 5> ret = { (sparse ? grain(i, j, k) : eta(i, j, k, 0)) * dv, 0.0, 0.0, 0.0, 0.0 };
 
-        Set::Vector grad = Numeric::Gradient(eta, i, j, k, 0, DX);
+        Set::Vector grad = sparse ? Numeric::Neighborhood<1>(grain, i, j, k).Gradient(DX)
+                                  : Numeric::Gradient(eta, i, j, k, 0, DX);
         Set::Scalar normgrad = grad.lpNorm<2>();
+        if (normgrad <= 1E-8) return ret;
 
-        if (normgrad > 1E-8)
-        {
-            Set::Vector normal = grad / normgrad;
+        Set::Vector normal = grad / normgrad;
+        Set::Scalar da = normgrad * dv;
+        ret[1] = da;
 
-            Set::Scalar da = normgrad * dv;
-            area += da;
+        if (isotropic)
+        {
+            ret[2] = pf.sigma0 * da;
+            Set::Scalar kappa = 0.75 * pf.sigma0 * pf.l_gb;
+            ret[3] = 0.5 * kappa * normgrad * normgrad * dv;
+            return ret;
+        }
 
-            if (!anisotropy.on || time < anisotropy.tstart)
-            {
-                gbenergy += pf.sigma0 * da;
-                Set::Scalar k = 0.75 * pf.sigma0 * pf.l_gb;
-                realgbenergy += 0.5 * k * normgrad * normgrad * dv;
-                regenergy = 0.0;
-            }
-            else
-            {
+        Set::Scalar sigma;
+#ifndef AMREX_USE_GPU
+        if (!gb.on()) sigma = gbmodel->W(normal);
+        else
+#endif
+        sigma = gb.W(normal);
+        ret[2] = sigma * da;
 #if AMREX_SPACEDIM == 2
-                Set::Scalar theta = atan2(grad(1), grad(0));
-                Set::Scalar sigma = boundary->W(theta);
-                gbenergy += sigma * da;
-
-                Set::Scalar k = 0.75 * sigma * pf.l_gb;
-                realgbenergy += 0.5 * k * normgrad * normgrad * dv;
-
-                Set::Matrix DDeta = Numeric::Hessian(eta, i, j, k, 0, DX, sten);
-                Set::Vector tangent(normal[1], -normal[0]);
-                Set::Scalar k2 = (DDeta * tangent).dot(tangent);
-                regenergy += 0.5 * anisotropy.beta * k2 * k2;
-#elif AMREX_SPACEDIM == 3
-                gbenergy += gbmodel.W(normal) * da;
+        Set::Scalar kappa = 0.75 * sigma * pf.l_gb;
+        ret[3] = 0.5 * kappa * normgrad * normgrad * dv;
+
+        Set::Matrix DDeta = sparse ? Numeric::Neighborhood<1>(grain, i, j, k).Hessian(DX)
+                                   : Numeric::Hessian(eta, i, j, k, 0, DX, sten);
+        Set::Vector tangent(normal[1], -normal[0]);
+        Set::Scalar k2 = (DDeta * tangent).dot(tangent);
+        ret[4] = 0.5 * anisotropy.beta * k2 * k2;
 #endif
-            }
-        }
+        return ret;
     });
 }
 
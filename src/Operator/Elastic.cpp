@@ -37,15 +37,22 @@ Elastic<SYM>::define(const Vector<Geometry>& a_geom,
 
     m_ddw_mf.resize(m_num_amr_levels);
     m_psi_mf.resize(m_num_amr_levels);
+    m_weight_mf.resize(m_num_amr_levels);
+    m_low_mf.resize(m_num_amr_levels);
     for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
     {
         m_ddw_mf[amrlev].resize(m_num_mg_levels[amrlev]);
         m_psi_mf[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_weight_mf[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_low_mf[amrlev].resize(m_num_mg_levels[amrlev]);
         for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
         {
-            m_ddw_mf[amrlev][mglev].reset(new MultiTab(amrex::convert(m_grids[amrlev][mglev],
-                amrex::IntVect::TheNodeVector()),
-                m_dmap[amrlev][mglev], 1, model_nghost));
+            // Single precision levels hold their double precision copy only while
+            // it is restricted (see averageDownCoeffsSameAmrLevel)
+            if (!m_compressed && !LowPrecision(amrlev, mglev))
+                m_ddw_mf[amrlev][mglev].reset(new MultiTab(amrex::convert(m_grids[amrlev][mglev],
+                    amrex::IntVect::TheNodeVector()),
+                    m_dmap[amrlev][mglev], 1, model_nghost));
             m_psi_mf[amrlev][mglev].reset(new MultiFab(m_grids[amrlev][mglev],
                 m_dmap[amrlev][mglev], 1, model_nghost));
 
@@ -58,11 +65,27 @@ template <int SYM>
 void
 Elastic<SYM>::SetModel(MATRIX4& a_model)
 {
+    if (m_compressed) Util::Abort(INFO, "Cannot set a full model on an operator in compressed mode");
+    if (m_soa) DefineSoA();
     for (int amrlev = 0; amrlev < m_num_amr_levels; amrlev++)
     {
         amrex::Box domain(m_geom[amrlev][0].Domain());
         domain.convert(amrex::IntVect::TheNodeVector());
 
+        if (m_soa)
+        {
+            const int nghost = m_weight_mf[amrlev][0]->nGrow();
+            for (MFIter mfi(*m_weight_mf[amrlev][0], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            {
+                Box bx = mfi.tilebox().grow(nghost) & domain;
+                amrex::Array4<Set::Scalar> const& w = m_weight_mf[amrlev][0]->array(mfi);
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    Pack(a_model, w, i, j, k);
+                });
+            }
+            continue;
+        }
+
         int nghost = m_ddw_mf[amrlev][0]->nGrow();
 
         for (MFIter mfi(*m_ddw_mf[amrlev][0], amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
@@ -90,17 +113,21 @@ void
 Elastic<SYM>::SetModel(int amrlev, const amrex::FabArray<amrex::BaseFab<MATRIX4> >& a_model)
 {
     BL_PROFILE("Operator::Elastic::SetModel()");
+    if (m_compressed) Util::Abort(INFO, "Cannot set a full model on an operator in compressed mode");
+    if (m_soa) DefineSoA();
 
     amrex::Box domain(m_geom[amrlev][0].Domain());
     domain.convert(amrex::IntVect::TheNodeVector());
 
-    if (a_model.boxArray() != m_ddw_mf[amrlev][0]->boxArray()) Util::Abort(INFO, "Inconsistent box arrays\n", "a_model.boxArray()=\n", a_model.boxArray(), "\n but the current box array is \n", m_ddw_mf[amrlev][0]->boxArray());
-    if (a_model.DistributionMap() != m_ddw_mf[amrlev][0]->DistributionMap()) Util::Abort(INFO, "Inconsistent distribution maps");
-    if (a_model.nComp() != m_ddw_mf[amrlev][0]->nComp()) Util::Abort(INFO, "Inconsistent # of components - should be ", m_ddw_mf[amrlev][0]->nComp());
-    if (a_model.nGrow() != m_ddw_mf[amrlev][0]->nGrow()) Util::Abort(INFO, "Inconsistent # of ghost nodes, should be ", m_ddw_mf[amrlev][0]->nGrow());
+    const amrex::FabArrayBase& ref = m_soa ? static_cast<const amrex::FabArrayBase&>(*m_weight_mf[amrlev][0])
+                                           : static_cast<const amrex::FabArrayBase&>(*m_ddw_mf[amrlev][0]);
+    if (a_model.boxArray() != ref.boxArray()) Util::Abort(INFO, "Inconsistent box arrays\n", "a_model.boxArray()=\n", a_model.boxArray(), "\n but the current box array is \n", ref.boxArray());
+    if (a_model.DistributionMap() != ref.DistributionMap()) Util::Abort(INFO, "Inconsistent distribution maps");
+    if (a_model.nComp() != 1) Util::Abort(INFO, "Inconsistent # of components - should be 1");
+    if (a_model.nGrow() != ref.nGrow()) Util::Abort(INFO, "Inconsistent # of ghost nodes, should be ", ref.nGrow());
 
 
-    int nghost = m_ddw_mf[amrlev][0]->nGrow();
+    int nghost = ref.nGrow();
 
     for (MFIter mfi(a_model, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
@@ -108,6 +135,16 @@ Elastic<SYM>::SetModel(int amrlev, const amrex::FabArray<amrex::BaseFab<MATRIX4>
         bx.grow(nghost);   // Expand to cover first layer of ghost nodes
         bx = bx & domain;  // Take intersection of box and the problem domain
 
+        if (m_soa)
+        {
+            amrex::Array4<Set::Scalar> const& w = m_weight_mf[amrlev][0]->array(mfi);
+            amrex::Array4<const MATRIX4> const& a_C = a_model.array(mfi);
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Pack(a_C(i, j, k), w, i, j, k);
+            });
+            continue;
+        }
+
         amrex::Array4<MATRIX4> const& C = (*(m_ddw_mf[amrlev][0])).array(mfi);
         amrex::Array4<const MATRIX4> const& a_C = a_model.array(mfi);
 
@@ -121,6 +158,83 @@ Elastic<SYM>::SetModel(int amrlev, const amrex::FabArray<amrex::BaseFab<MATRIX4>
     m_model_set = true;
 }
 
+template <int SYM>
+void
+Elastic<SYM>::DefineSoA()
+{
+    if (!m_ddw_mf[0][0]) return;
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            const int nghost = m_psi_mf[amrlev][mglev]->nGrow();
+            m_ddw_mf[amrlev][mglev].reset();
+            if (LowPrecision(amrlev, mglev)) continue;
+            m_weight_mf[amrlev][mglev].reset(new MultiFab(amrex::convert(m_grids[amrlev][mglev],
+                amrex::IntVect::TheNodeVector()),
+                m_dmap[amrlev][mglev], NPACK, nghost));
+            m_weight_mf[amrlev][mglev]->setVal(0.0);
+        }
+}
+
+template <int SYM>
+void
+Elastic<SYM>::SetModel(const amrex::Vector<MATRIX4>& a_table, int amrlev, const amrex::MultiFab& a_weights)
+{
+    BL_PROFILE("Operator::Elastic::SetModel()");
+
+    amrex::Box domain(m_geom[amrlev][0].Domain());
+    domain.convert(amrex::IntVect::TheNodeVector());
+
+    const amrex::BoxArray ba = amrex::convert(m_grids[amrlev][0], amrex::IntVect::TheNodeVector());
+    const int nghost = m_psi_mf[amrlev][0]->nGrow();
+
+    if (a_table.size() == 0) Util::Abort(INFO, "Table of base moduli is empty");
+    if (a_weights.nComp() != (int)a_table.size()) Util::Abort(INFO, "Inconsistent # of components - there are ", a_table.size(), " table entries but ", a_weights.nComp(), " weights");
+    if (a_weights.boxArray() != ba) Util::Abort(INFO, "Inconsistent box arrays\n", "a_weights.boxArray()=\n", a_weights.boxArray(), "\n but the current box array is \n", ba);
+    if (a_weights.DistributionMap() != m_dmap[amrlev][0]) Util::Abort(INFO, "Inconsistent distribution maps");
+    if (a_weights.nGrow() != nghost) Util::Abort(INFO, "Inconsistent # of ghost nodes, should be ", nghost);
+
+    // Release the full Matrix4 storage on every level (if it was allocated)
+    if (!m_compressed || m_ddw_mf[0][0])
+    {
+        for (int ilev = 0; ilev < m_num_amr_levels; ++ilev)
+            for (int mglev = 0; mglev < m_num_mg_levels[ilev]; ++mglev)
+                m_ddw_mf[ilev][mglev].reset();
+        m_compressed = true;
+    }
+    if (m_ntable && m_ntable != (int)a_table.size())
+        Util::Abort(INFO, "The number of base moduli cannot change once set");
+    m_ntable = a_table.size();
+    m_ddw_table.resize(m_ntable);
+    amrex::Gpu::copy(amrex::Gpu::hostToDevice, a_table.begin(), a_table.end(), m_ddw_table.begin());
+
+    const int ncomp = a_weights.nComp();
+    for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+    {
+        if (m_weight_mf[amrlev][mglev] || LowPrecision(amrlev, mglev)) continue;
+        m_weight_mf[amrlev][mglev].reset(new MultiFab(amrex::convert(m_grids[amrlev][mglev],
+            amrex::IntVect::TheNodeVector()),
+            m_dmap[amrlev][mglev], ncomp, nghost));
+        m_weight_mf[amrlev][mglev]->setVal(0.0);
+    }
+
+    for (MFIter mfi(a_weights, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box bx = mfi.tilebox();
+        bx.grow(nghost);   // Expand to cover first layer of ghost nodes
+        bx = bx & domain;  // Take intersection of box and the problem domain
+
+        amrex::Array4<Set::Scalar> const& w = m_weight_mf[amrlev][0]->array(mfi);
+        amrex::Array4<const Set::Scalar> const& a_w = a_weights.array(mfi);
+
+        amrex::ParallelFor(bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+            w(i, j, k, n) = a_w(i, j, k, n);
+        });
+    }
+
+    m_model_set = true;
+}
+
 template <int SYM>
 void
 Elastic<SYM>::SetPsi(int amrlev, const amrex::MultiFab& a_psi_mf)
@@ -158,7 +272,17 @@ Elastic<SYM>::Fapply(int amrlev, int mglev, MultiFab& a_f, const MultiFab& a_u)
         Box bx = mfi.validbox().grow(1) & domain;
         amrex::Box tilebox = mfi.grownnodaltilebox() & bx;
 
-        amrex::Array4<MATRIX4> const& DDW = (*(m_ddw_mf[amrlev][mglev])).array(mfi);
+        amrex::Array4<MATRIX4> DDW;
+        amrex::Array4<const Set::Scalar> W;
+        amrex::Array4<const float> L;
+        const bool low = LowCoeffs(amrlev, mglev);
+        if (low) L = m_low_mf[amrlev][mglev]->const_array(mfi);
+        else if (m_compressed || m_soa) W = m_weight_mf[amrlev][mglev]->const_array(mfi);
+        else DDW = (*(m_ddw_mf[amrlev][mglev])).array(mfi);
+        const bool compressed = m_compressed, soa = m_soa && !m_compressed;
+        const MATRIX4* table = m_ddw_table.data();
+        const int ntable = m_ntable;
+
         amrex::Array4<const amrex::Real> const& U = a_u.array(mfi);
         amrex::Array4<amrex::Real> const& F = a_f.array(mfi);
         amrex::Array4<Set::Scalar> const& psi = m_psi_mf[amrlev][mglev]->array(mfi);
@@ -169,6 +293,11 @@ Elastic<SYM>::Fapply(int amrlev, int mglev, MultiFab& a_f, const MultiFab& a_u)
 
             Set::Vector f = Set::Vector::Zero();
 
+            // Modulus at this node, either read directly or rebuilt from the mixing weights
+            // or from its per-component (SoA) representation
+            const MATRIX4 C = low ? (compressed ? Mix(L, table, ntable, i, j, k) : Unpack(L, i, j, k))
+                                  : (compressed ? Mix(W, table, ntable, i, j, k) : soa ? Unpack(W, i, j, k) : DDW(i, j, k));
+
             Set::Vector u;
             for (int p = 0; p < AMREX_SPACEDIM; p++) u(p) = U(i, j, k, p);
 
@@ -195,7 +324,7 @@ Elastic<SYM>::Fapply(int amrlev, int mglev, MultiFab& a_f, const MultiFab& a_u)
             if (m_psi_set) psi_avg = (1.0 - m_psi_small) * Numeric::Interpolate::CellToNodeAverage(psi, i, j, k, 0) + m_psi_small;
 
             // Stress tensor computed using the model fab
-            Set::Matrix sig = (DDW(i, j, k) * gradu) * psi_avg;
+            Set::Matrix sig = (C * gradu) * psi_avg;
 
             // Boundary conditions
             /// \todo Important: we need a way to handle corners and edges.
@@ -241,14 +370,45 @@ Elastic<SYM>::Fapply(int amrlev, int mglev, MultiFab& a_f, const MultiFab& a_u)
                 //    f_i = C_{ijkl,j} u_{k,l}  +  C_{ijkl}u_{k,lj}
                 //
 
-                f = (DDW(i, j, k) * gradgradu) * psi_avg;
+                f = (C * gradgradu) * psi_avg;
 
                 if (!m_uniform)
                 {
-                    MATRIX4
-                        AMREX_D_DECL(Cgrad1 = (Numeric::Stencil<MATRIX4, 1, 0, 0>::D(DDW, i, j, k, 0, DX, sten)),
-                            Cgrad2 = (Numeric::Stencil<MATRIX4, 0, 1, 0>::D(DDW, i, j, k, 0, DX, sten)),
-                            Cgrad3 = (Numeric::Stencil<MATRIX4, 0, 0, 1>::D(DDW, i, j, k, 0, DX, sten)));
+                    MATRIX4 AMREX_D_DECL(Cgrad1, Cgrad2, Cgrad3);
+                    if (compressed)
+                    {
+                        // grad(C) = sum_n grad(w_n) C_n
+                        if (low)
+                        {
+                            AMREX_D_TERM(Cgrad1 = (MixD<1, 0, 0>(L, table, ntable, i, j, k, DX, sten));,
+                                Cgrad2 = (MixD<0, 1, 0>(L, table, ntable, i, j, k, DX, sten));,
+                                Cgrad3 = (MixD<0, 0, 1>(L, table, ntable, i, j, k, DX, sten)););
+                        }
+                        else
+                        {
+                            AMREX_D_TERM(Cgrad1 = (MixD<1, 0, 0>(W, table, ntable, i, j, k, DX, sten));,
+                                Cgrad2 = (MixD<0, 1, 0>(W, table, ntable, i, j, k, DX, sten));,
+                                Cgrad3 = (MixD<0, 0, 1>(W, table, ntable, i, j, k, DX, sten)););
+                        }
+                    }
+                    else if (low)
+                    {
+                        AMREX_D_TERM(Cgrad1 = (UnpackD<1, 0, 0>(L, i, j, k, DX, sten));,
+                            Cgrad2 = (UnpackD<0, 1, 0>(L, i, j, k, DX, sten));,
+                            Cgrad3 = (UnpackD<0, 0, 1>(L, i, j, k, DX, sten)););
+                    }
+                    else if (soa)
+                    {
+                        AMREX_D_TERM(Cgrad1 = (UnpackD<1, 0, 0>(W, i, j, k, DX, sten));,
+                            Cgrad2 = (UnpackD<0, 1, 0>(W, i, j, k, DX, sten));,
+                            Cgrad3 = (UnpackD<0, 0, 1>(W, i, j, k, DX, sten)););
+                    }
+                    else
+                    {
+                        AMREX_D_TERM(Cgrad1 = (Numeric::Stencil<MATRIX4, 1, 0, 0>::D(DDW, i, j, k, 0, DX, sten));,
+                            Cgrad2 = (Numeric::Stencil<MATRIX4, 0, 1, 0>::D(DDW, i, j, k, 0, DX, sten));,
+                            Cgrad3 = (Numeric::Stencil<MATRIX4, 0, 0, 1>::D(DDW, i, j, k, 0, DX, sten)););
+                    }
                     f += (AMREX_D_TERM((Cgrad1 * gradu).col(0),
                         +(Cgrad2 * gradu).col(1),
                         +(Cgrad3 * gradu).col(2))) * (psi_avg);
@@ -257,7 +417,7 @@ Elastic<SYM>::Fapply(int amrlev, int mglev, MultiFab& a_f, const MultiFab& a_u)
                 {
                     Set::Vector gradpsi = Numeric::CellGradientOnNode(psi, i, j, k, 0, DX);
                     gradpsi *= (1.0 - m_psi_small);
-                    f += (DDW(i, j, k) * gradu) * gradpsi;
+                    f += (C * gradu) * gradpsi;
                 }
             }
             AMREX_D_TERM(F(i, j, k, 0) = f[0];, F(i, j, k, 1) = f[1];, F(i, j, k, 2) = f[2];);
@@ -282,7 +442,18 @@ Elastic<SYM>::Diagonal(int amrlev, int mglev, MultiFab& a_diag)
         Box bx = mfi.validbox().grow(1) & domain;
         amrex::Box tilebox = mfi.grownnodaltilebox() & bx;
 
-        amrex::Array4<MATRIX4> const& DDW = (*(m_ddw_mf[amrlev][mglev])).array(mfi);
+        amrex::Array4<MATRIX4> DDW;
+        amrex::Array4<const Set::Scalar> W;
+        amrex::Array4<const float> L;
+        // The diagonal is only computed outside the smoother
+        const bool low = LowPrecision(amrlev, mglev);
+        if (low) L = m_low_mf[amrlev][mglev]->const_array(mfi);
+        else if (m_compressed || m_soa) W = m_weight_mf[amrlev][mglev]->const_array(mfi);
+        else DDW = (*(m_ddw_mf[amrlev][mglev])).array(mfi);
+        const bool compressed = m_compressed, soa = m_soa && !m_compressed;
+        const MATRIX4* table = m_ddw_table.data();
+        const int ntable = m_ntable;
+
         amrex::Array4<Set::Scalar> const& diag = a_diag.array(mfi);
         amrex::Array4<Set::Scalar> const& psi = m_psi_mf[amrlev][mglev]->array(mfi);
 
@@ -292,6 +463,9 @@ Elastic<SYM>::Diagonal(int amrlev, int mglev, MultiFab& a_diag)
 
             Set::Vector f = Set::Vector::Zero();
 
+            const MATRIX4 C = low ? (compressed ? Mix(L, table, ntable, i, j, k) : Unpack(L, i, j, k))
+                                  : (compressed ? Mix(W, table, ntable, i, j, k) : soa ? Unpack(W, i, j, k) : DDW(i, j, k));
+
             bool    AMREX_D_DECL(xmin = (i == lo.x), ymin = (j == lo.y), zmin = (k == lo.z)),
                 AMREX_D_DECL(xmax = (i == hi.x), ymax = (j == hi.y), zmax = (k == hi.z));
 
@@ -330,7 +504,7 @@ Elastic<SYM>::Diagonal(int amrlev, int mglev, MultiFab& a_diag)
                 amrex::IntVect m(AMREX_D_DECL(i, j, k));
                 if (AMREX_D_TERM(xmax || xmin, || ymax || ymin, || zmax || zmin))
                 {
-                    Set::Matrix sig = DDW(i, j, k) * gradu * psi_avg;
+                    Set::Matrix sig = C * gradu * psi_avg;
                     Set::Vector u = Set::Vector::Zero();
                     u(p) = 1.0;
                     f = (*m_bc)(u, gradu, sig, i, j, k, domain);
@@ -338,7 +512,7 @@ Elastic<SYM>::Diagonal(int amrlev, int mglev, MultiFab& a_diag)
                 }
                 else
                 {
-                    Set::Vector f = (DDW(i, j, k) * gradgradu) * psi_avg;
+                    Set::Vector f = (C * gradgradu) * psi_avg;
                     diag(i, j, k, p) += f(p);
                 }
 
@@ -476,7 +650,13 @@ Elastic<SYM>::Stress(int amrlev,
     for (MFIter mfi(a_u, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        amrex::Array4<Set::Matrix4<AMREX_SPACEDIM, SYM>> const& DDW = (*(m_ddw_mf[amrlev][0])).array(mfi);
+        amrex::Array4<MATRIX4> DDW;
+        amrex::Array4<const Set::Scalar> W;
+        if (m_compressed || m_soa) W = m_weight_mf[amrlev][0]->const_array(mfi);
+        else DDW = (*(m_ddw_mf[amrlev][0])).array(mfi);
+        const bool compressed = m_compressed, soa = m_soa && !m_compressed;
+        const MATRIX4* table = m_ddw_table.data();
+        const int ntable = m_ntable;
         amrex::Array4<amrex::Real> const& sigma = a_sigma.array(mfi);
         amrex::Array4<Set::Scalar> const& psi = m_psi_mf[amrlev][0]->array(mfi);
         amrex::Array4<const amrex::Real> const& u = a_u.array(mfi);
@@ -497,7 +677,8 @@ Elastic<SYM>::Stress(int amrlev,
 
             Set::Scalar psi_avg = 1.0;
             if (m_psi_set) psi_avg = (1.0 - m_psi_small) * Numeric::Interpolate::CellToNodeAverage(psi, i, j, k, 0) + m_psi_small;
-            Set::Matrix sig = (DDW(i, j, k) * gradu) * psi_avg;
+            const MATRIX4 C = compressed ? Mix(W, table, ntable, i, j, k) : soa ? Unpack(W, i, j, k) : DDW(i, j, k);
+            Set::Matrix sig = (C * gradu) * psi_avg;
 
             if (voigt)
             {
@@ -541,7 +722,13 @@ Elastic<SYM>::Energy(int amrlev,
     for (MFIter mfi(a_u, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        amrex::Array4<Set::Matrix4<AMREX_SPACEDIM, SYM>> const& DDW = (*(m_ddw_mf[amrlev][0])).array(mfi);
+        amrex::Array4<MATRIX4> DDW;
+        amrex::Array4<const Set::Scalar> W;
+        if (m_compressed || m_soa) W = m_weight_mf[amrlev][0]->const_array(mfi);
+        else DDW = (*(m_ddw_mf[amrlev][0])).array(mfi);
+        const bool compressed = m_compressed, soa = m_soa && !m_compressed;
+        const MATRIX4* table = m_ddw_table.data();
+        const int ntable = m_ntable;
         amrex::Array4<amrex::Real> const& energy = a_energy.array(mfi);
         amrex::Array4<const amrex::Real> const& u = a_u.array(mfi);
         amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k)
@@ -560,7 +747,8 @@ Elastic<SYM>::Energy(int amrlev,
             }
 
             Set::Matrix eps = .5 * (gradu + gradu.transpose());
-            Set::Matrix sig = DDW(i, j, k) * gradu;
+            const MATRIX4 C = compressed ? Mix(W, table, ntable, i, j, k) : soa ? Unpack(W, i, j, k) : DDW(i, j, k);
+            Set::Matrix sig = C * gradu;
 
             // energy(i,j,k) = (gradu.transpose() * sig).trace();
 
@@ -585,19 +773,103 @@ Elastic<SYM>::averageDownCoeffs()
 
     if (m_average_down_coeffs)
         for (int amrlev = m_num_amr_levels - 1; amrlev > 0; --amrlev)
-            averageDownCoeffsDifferentAmrLevels(amrlev);
+        {
+            if (m_compressed || m_soa) averageDownWeightsDifferentAmrLevels(amrlev);
+            else averageDownCoeffsDifferentAmrLevels(amrlev);
+        }
 
     averageDownCoeffsSameAmrLevel(0);
     for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
     {
         for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
         {
-            if (m_ddw_mf[amrlev][mglev]) {
+            // Single precision levels were filled before their double precision copy was released
+            if (m_ddw_mf[amrlev][mglev])
                 FillBoundaryCoeff(*m_ddw_mf[amrlev][mglev], m_geom[amrlev][mglev]);
-                FillBoundaryCoeff(*m_psi_mf[amrlev][mglev], m_geom[amrlev][mglev]);
-            }
+            else if (m_weight_mf[amrlev][mglev])
+                FillBoundaryCoeff(*m_weight_mf[amrlev][mglev], m_geom[amrlev][mglev]);
+            FillBoundaryCoeff(*m_psi_mf[amrlev][mglev], m_geom[amrlev][mglev]);
+        }
+    }
+
+    // The smoother copies of the double precision levels are refreshed here;
+    // those of the single precision levels were made in averageDownCoeffsSameAmrLevel
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+            if (m_mixed_precision_smoother && !LowPrecision(amrlev, mglev))
+                PackCoeffs(amrlev, mglev);
+}
+
+template<int SYM>
+void
+Elastic<SYM>::Fsmooth(int amrlev, int mglev, MultiFab& x, const MultiFab& b) const
+{
+    BL_PROFILE("Elastic::Fsmooth()");
+    // Residuals (correctionResidual, solutionResidual) call Fapply outside of
+    // this scope, so they keep using the double precision coefficients.
+    m_smoothing = true;
+    Operator<Grid::Node>::Fsmooth(amrlev, mglev, x, b);
+    m_smoothing = false;
+}
+
+template<int SYM>
+void
+Elastic<SYM>::PackCoeffs(int amrlev, int mglev)
+{
+    BL_PROFILE("Elastic::PackCoeffs()");
+
+    // Mixing weights (compressed) and SoA coefficients are both stored per component
+    const bool compressed = m_compressed || m_soa;
+    const int ncomp = compressed ? m_weight_mf[amrlev][mglev]->nComp() : NPACK;
+    const int nghost = compressed ? m_weight_mf[amrlev][mglev]->nGrow() : m_ddw_mf[amrlev][mglev]->nGrow();
+
+    std::unique_ptr<LowFab>& low = m_low_mf[amrlev][mglev];
+    if (!low || low->nComp() != ncomp)
+        low.reset(new LowFab(amrex::convert(m_grids[amrlev][mglev], amrex::IntVect::TheNodeVector()),
+            m_dmap[amrlev][mglev], ncomp, nghost));
+
+    for (MFIter mfi(*low, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box bx = mfi.growntilebox();
+        amrex::Array4<float> const& c = low->array(mfi);
+        if (compressed)
+        {
+            amrex::Array4<const Set::Scalar> const& w = m_weight_mf[amrlev][mglev]->const_array(mfi);
+            amrex::ParallelFor(bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                c(i, j, k, n) = (float)w(i, j, k, n);
+            });
+        }
+        else
+        {
+            amrex::Array4<const MATRIX4> const& ddw = m_ddw_mf[amrlev][mglev]->const_array(mfi);
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                Pack(ddw(i, j, k), c, i, j, k);
+            });
         }
     }
+
+}
+
+template<int SYM>
+void
+Elastic<SYM>::AllocateCoeffs(int amrlev, int mglev)
+{
+    if (m_ddw_mf[amrlev][mglev] || m_weight_mf[amrlev][mglev]) return;
+    const amrex::BoxArray ba = amrex::convert(m_grids[amrlev][mglev], amrex::IntVect::TheNodeVector());
+    const int nghost = m_psi_mf[amrlev][mglev]->nGrow();
+    if (m_compressed || m_soa)
+        m_weight_mf[amrlev][mglev].reset(new MultiFab(ba, m_dmap[amrlev][mglev], m_compressed ? m_ntable : NPACK, nghost));
+    else
+        m_ddw_mf[amrlev][mglev].reset(new MultiTab(ba, m_dmap[amrlev][mglev], 1, nghost));
+}
+
+template<int SYM>
+void
+Elastic<SYM>::ReleaseCoeffs(int amrlev, int mglev)
+{
+    PackCoeffs(amrlev, mglev);
+    m_ddw_mf[amrlev][mglev].reset();
+    m_weight_mf[amrlev][mglev].reset();
 }
 
 template<int SYM>
@@ -648,7 +920,6 @@ Elastic<SYM>::averageDownCoeffsDifferentAmrLevels(int fine_amrlev)
         for (int n = 0; n < fine_ddw.nComp(); n++)
         {
             // I,J,K == coarse coordinates
-            // i,j,k == fine coordinates
             amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int I, int J, int K) {
                 int i = I * 2, j = J * 2, k = K * 2;
 
@@ -715,6 +986,63 @@ Elastic<SYM>::averageDownCoeffsDifferentAmrLevels(int fine_amrlev)
 
 
 
+namespace
+{
+// Restriction of nodal data from fine node (2I,2J,2K) to coarse node (I,J,K), with
+// the face/edge/corner treatment at the domain boundary. Used for the Matrix4
+// coefficients (T = MATRIX4, n = 0), the mixing or SoA weights, and psi.
+template <class T>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+T RestrictNode(const amrex::Array4<const T>& fdata,
+    const int I, const int J, const int K, const int n,
+    const Dim3& lo, const Dim3& hi)
+{
+    int i = 2 * I, j = 2 * J, k = 2 * K;
+
+    if ((I == lo.x || I == hi.x) &&
+        (J == lo.y || J == hi.y) &&
+        (K == lo.z || K == hi.z)) // Corner
+        return fdata(i, j, k, n);
+    else if ((J == lo.y || J == hi.y) &&
+        (K == lo.z || K == hi.z)) // X edge
+        return fdata(i - 1, j, k, n) * 0.25 + fdata(i, j, k, n) * 0.5 + fdata(i + 1, j, k, n) * 0.25;
+    else if ((K == lo.z || K == hi.z) &&
+        (I == lo.x || I == hi.x)) // Y edge
+        return fdata(i, j - 1, k, n) * 0.25 + fdata(i, j, k, n) * 0.5 + fdata(i, j + 1, k, n) * 0.25;
+    else if ((I == lo.x || I == hi.x) &&
+        (J == lo.y || J == hi.y)) // Z edge
+        return fdata(i, j, k - 1, n) * 0.25 + fdata(i, j, k, n) * 0.5 + fdata(i, j, k + 1, n) * 0.25;
+    else if (I == lo.x || I == hi.x) // X face
+        return
+        (fdata(i, j - 1, k - 1, n) + fdata(i, j, k - 1, n) * 2.0 + fdata(i, j + 1, k - 1, n)
+            + fdata(i, j - 1, k, n) * 2.0 + fdata(i, j, k, n) * 4.0 + fdata(i, j + 1, k, n) * 2.0
+            + fdata(i, j - 1, k + 1, n) + fdata(i, j, k + 1, n) * 2.0 + fdata(i, j + 1, k + 1, n)) / 16.0;
+    else if (J == lo.y || J == hi.y) // Y face
+        return
+        (fdata(i - 1, j, k - 1, n) + fdata(i - 1, j, k, n) * 2.0 + fdata(i - 1, j, k + 1, n)
+            + fdata(i, j, k - 1, n) * 2.0 + fdata(i, j, k, n) * 4.0 + fdata(i, j, k + 1, n) * 2.0
+            + fdata(i + 1, j, k - 1, n) + fdata(i + 1, j, k, n) * 2.0 + fdata(i + 1, j, k + 1, n)) / 16.0;
+    else if (K == lo.z || K == hi.z) // Z face
+        return
+        (fdata(i - 1, j - 1, k, n) + fdata(i, j - 1, k, n) * 2.0 + fdata(i + 1, j - 1, k, n)
+            + fdata(i - 1, j, k, n) * 2.0 + fdata(i, j, k, n) * 4.0 + fdata(i + 1, j, k, n) * 2.0
+            + fdata(i - 1, j + 1, k, n) + fdata(i, j + 1, k, n) * 2.0 + fdata(i + 1, j + 1, k, n)) / 16.0;
+    else // Interior
+        return
+        (fdata(i - 1, j - 1, k - 1, n) + fdata(i - 1, j - 1, k + 1, n) + fdata(i - 1, j + 1, k - 1, n) + fdata(i - 1, j + 1, k + 1, n) +
+            fdata(i + 1, j - 1, k - 1, n) + fdata(i + 1, j - 1, k + 1, n) + fdata(i + 1, j + 1, k - 1, n) + fdata(i + 1, j + 1, k + 1, n)) / 64.0
+        +
+        (fdata(i, j - 1, k - 1, n) + fdata(i, j - 1, k + 1, n) + fdata(i, j + 1, k - 1, n) + fdata(i, j + 1, k + 1, n) +
+            fdata(i - 1, j, k - 1, n) + fdata(i + 1, j, k - 1, n) + fdata(i - 1, j, k + 1, n) + fdata(i + 1, j, k + 1, n) +
+            fdata(i - 1, j - 1, k, n) + fdata(i - 1, j + 1, k, n) + fdata(i + 1, j - 1, k, n) + fdata(i + 1, j + 1, k, n)) / 32.0
+        +
+        (fdata(i - 1, j, k, n) + fdata(i, j - 1, k, n) + fdata(i, j, k - 1, n) +
+            fdata(i + 1, j, k, n) + fdata(i, j + 1, k, n) + fdata(i, j, k + 1, n)) / 16.0
+        +
+        fdata(i, j, k, n) / 8.0;
+}
+}
+
 template<int SYM>
 void
 Elastic<SYM>::averageDownCoeffsSameAmrLevel(int amrlev)
@@ -728,82 +1056,47 @@ Elastic<SYM>::averageDownCoeffsSameAmrLevel(int amrlev)
         amrex::Box fdomain(m_geom[amrlev][mglev - 1].Domain());
         fdomain.convert(amrex::IntVect::TheNodeVector());
 
-        MultiTab& crse = *m_ddw_mf[amrlev][mglev];
-        MultiTab& fine = *m_ddw_mf[amrlev][mglev - 1];
-
-        amrex::BoxArray crseba = crse.boxArray();
-        amrex::BoxArray fineba = fine.boxArray();
-
-        BoxArray newba = crseba;
+        BoxArray newba = amrex::convert(m_grids[amrlev][mglev], amrex::IntVect::TheNodeVector());
         newba.refine(2);
-        MultiTab fine_on_crseba;
-        fine_on_crseba.define(newba, crse.DistributionMap(), 1, 4);
-        fine_on_crseba.ParallelCopy(fine, 0, 0, 1, 2, 4, m_geom[amrlev][mglev].periodicity());
 
-        for (MFIter mfi(crse, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        // The double precision copy of a single precision level is restricted from
+        // the next finer level, converted once the next coarser level has been
+        // restricted from it, and released, so at most two exist at a time.
+        if (LowPrecision(amrlev, mglev)) AllocateCoeffs(amrlev, mglev);
+
+        if (m_compressed || m_soa) averageDownWeightsSameAmrLevel(amrlev, mglev);
+        else
         {
-            Box bx = mfi.tilebox();
-            bx = bx & cdomain;
+            MultiTab& crse = *m_ddw_mf[amrlev][mglev];
+            MultiTab& fine = *m_ddw_mf[amrlev][mglev - 1];
 
-            amrex::Array4<const Set::Matrix4<AMREX_SPACEDIM, SYM>> const& fdata = fine_on_crseba.array(mfi);
-            amrex::Array4<Set::Matrix4<AMREX_SPACEDIM, SYM>> const& cdata = crse.array(mfi);
+            MultiTab fine_on_crseba;
+            fine_on_crseba.define(newba, crse.DistributionMap(), 1, 4);
+            fine_on_crseba.ParallelCopy(fine, 0, 0, 1, 2, 4, m_geom[amrlev][mglev].periodicity());
 
-            const Dim3 lo = amrex::lbound(cdomain), hi = amrex::ubound(cdomain);
+            for (MFIter mfi(crse, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            {
+                Box bx = mfi.tilebox();
+                bx = bx & cdomain;
 
-            // I,J,K == coarse coordinates
-            // i,j,k == fine coordinates
-            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int I, int J, int K) {
-                int i = 2 * I, j = 2 * J, k = 2 * K;
-
-                if ((I == lo.x || I == hi.x) &&
-                    (J == lo.y || J == hi.y) &&
-                    (K == lo.z || K == hi.z)) // Corner
-                    cdata(I, J, K) = fdata(i, j, k);
-                else if ((J == lo.y || J == hi.y) &&
-                    (K == lo.z || K == hi.z)) // X edge
-                    cdata(I, J, K) = fdata(i - 1, j, k) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i + 1, j, k) * 0.25;
-                else if ((K == lo.z || K == hi.z) &&
-                    (I == lo.x || I == hi.x)) // Y edge
-                    cdata(I, J, K) = fdata(i, j - 1, k) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i, j + 1, k) * 0.25;
-                else if ((I == lo.x || I == hi.x) &&
-                    (J == lo.y || J == hi.y)) // Z edge
-                    cdata(I, J, K) = fdata(i, j, k - 1) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i, j, k + 1) * 0.25;
-                else if (I == lo.x || I == hi.x) // X face
-                    cdata(I, J, K) =
-                    (fdata(i, j - 1, k - 1) + fdata(i, j, k - 1) * 2.0 + fdata(i, j + 1, k - 1)
-                        + fdata(i, j - 1, k) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i, j + 1, k) * 2.0
-                        + fdata(i, j - 1, k + 1) + fdata(i, j, k + 1) * 2.0 + fdata(i, j + 1, k + 1)) / 16.0;
-                else if (J == lo.y || J == hi.y) // Y face
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j, k - 1) + fdata(i - 1, j, k) * 2.0 + fdata(i - 1, j, k + 1)
-                        + fdata(i, j, k - 1) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i, j, k + 1) * 2.0
-                        + fdata(i + 1, j, k - 1) + fdata(i + 1, j, k) * 2.0 + fdata(i + 1, j, k + 1)) / 16.0;
-                else if (K == lo.z || K == hi.z) // Z face
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j - 1, k) + fdata(i, j - 1, k) * 2.0 + fdata(i + 1, j - 1, k)
-                        + fdata(i - 1, j, k) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i + 1, j, k) * 2.0
-                        + fdata(i - 1, j + 1, k) + fdata(i, j + 1, k) * 2.0 + fdata(i + 1, j + 1, k)) / 16.0;
-                else // Interior
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j - 1, k - 1) + fdata(i - 1, j - 1, k + 1) + fdata(i - 1, j + 1, k - 1) + fdata(i - 1, j + 1, k + 1) +
-                        fdata(i + 1, j - 1, k - 1) + fdata(i + 1, j - 1, k + 1) + fdata(i + 1, j + 1, k - 1) + fdata(i + 1, j + 1, k + 1)) / 64.0
-                    +
-                    (fdata(i, j - 1, k - 1) + fdata(i, j - 1, k + 1) + fdata(i, j + 1, k - 1) + fdata(i, j + 1, k + 1) +
-                        fdata(i - 1, j, k - 1) + fdata(i + 1, j, k - 1) + fdata(i - 1, j, k + 1) + fdata(i + 1, j, k + 1) +
-                        fdata(i - 1, j - 1, k) + fdata(i - 1, j + 1, k) + fdata(i + 1, j - 1, k) + fdata(i + 1, j + 1, k)) / 32.0
-                    +
-                    (fdata(i - 1, j, k) + fdata(i, j - 1, k) + fdata(i, j, k - 1) +
-                        fdata(i + 1, j, k) + fdata(i, j + 1, k) + fdata(i, j, k + 1)) / 16.0
-                    +
-                    fdata(i, j, k) / 8.0;
+                amrex::Array4<const Set::Matrix4<AMREX_SPACEDIM, SYM>> const& fdata = fine_on_crseba.array(mfi);
+                amrex::Array4<Set::Matrix4<AMREX_SPACEDIM, SYM>> const& cdata = crse.array(mfi);
+
+                const Dim3 lo = amrex::lbound(cdomain), hi = amrex::ubound(cdomain);
+
+                // I,J,K == coarse coordinates
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int I, int J, int K) {
+                    cdata(I, J, K) = RestrictNode(fdata, I, J, K, 0, lo, hi);
 
 #ifdef AMREX_DEBUG
-                if (cdata(I, J, K).contains_nan()) Util::Abort(INFO, "restricted model is nan at crse coordinates (I=", I, ",J=", J, ",K=", k, "), amrlev=", amrlev, " interpolating from mglev", mglev - 1, " to ", mglev);
+                    if (cdata(I, J, K).contains_nan()) Util::Abort(INFO, "restricted model is nan at crse coordinates (I=", I, ",J=", J, ",K=", K, "), amrlev=", amrlev, " interpolating from mglev", mglev - 1, " to ", mglev);
 #endif
-            });
+                });
+            }
+            FillBoundaryCoeff(crse, m_geom[amrlev][mglev]);
         }
-        FillBoundaryCoeff(crse, m_geom[amrlev][mglev]);
-
+        if (LowPrecision(amrlev, mglev - 1)) ReleaseCoeffs(amrlev, mglev - 1);
+        if (mglev == m_num_mg_levels[amrlev] - 1 && LowPrecision(amrlev, mglev)) ReleaseCoeffs(amrlev, mglev);
 
         if (!m_psi_set) continue;
 
@@ -826,51 +1119,8 @@ Elastic<SYM>::averageDownCoeffsSameAmrLevel(int amrlev)
             const Dim3 lo = amrex::lbound(cdomain), hi = amrex::ubound(cdomain);
 
             // I,J,K == coarse coordinates
-            // i,j,k == fine coordinates
             amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int I, int J, int K) {
-                int i = 2 * I, j = 2 * J, k = 2 * K;
-
-                if ((I == lo.x || I == hi.x) &&
-                    (J == lo.y || J == hi.y) &&
-                    (K == lo.z || K == hi.z)) // Corner
-                    cdata(I, J, K) = fdata(i, j, k);
-                else if ((J == lo.y || J == hi.y) &&
-                    (K == lo.z || K == hi.z)) // X edge
-                    cdata(I, J, K) = fdata(i - 1, j, k) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i + 1, j, k) * 0.25;
-                else if ((K == lo.z || K == hi.z) &&
-                    (I == lo.x || I == hi.x)) // Y edge
-                    cdata(I, J, K) = fdata(i, j - 1, k) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i, j + 1, k) * 0.25;
-                else if ((I == lo.x || I == hi.x) &&
-                    (J == lo.y || J == hi.y)) // Z edge
-                    cdata(I, J, K) = fdata(i, j, k - 1) * 0.25 + fdata(i, j, k) * 0.5 + fdata(i, j, k + 1) * 0.25;
-                else if (I == lo.x || I == hi.x) // X face
-                    cdata(I, J, K) =
-                    (fdata(i, j - 1, k - 1) + fdata(i, j, k - 1) * 2.0 + fdata(i, j + 1, k - 1)
-                        + fdata(i, j - 1, k) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i, j + 1, k) * 2.0
-                        + fdata(i, j - 1, k + 1) + fdata(i, j, k + 1) * 2.0 + fdata(i, j + 1, k + 1)) / 16.0;
-                else if (J == lo.y || J == hi.y) // Y face
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j, k - 1) + fdata(i - 1, j, k) * 2.0 + fdata(i - 1, j, k + 1)
-                        + fdata(i, j, k - 1) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i, j, k + 1) * 2.0
-                        + fdata(i + 1, j, k - 1) + fdata(i + 1, j, k) * 2.0 + fdata(i + 1, j, k + 1)) / 16.0;
-                else if (K == lo.z || K == hi.z) // Z face
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j - 1, k) + fdata(i, j - 1, k) * 2.0 + fdata(i + 1, j - 1, k)
-                        + fdata(i - 1, j, k) * 2.0 + fdata(i, j, k) * 4.0 + fdata(i + 1, j, k) * 2.0
-                        + fdata(i - 1, j + 1, k) + fdata(i, j + 1, k) * 2.0 + fdata(i + 1, j + 1, k)) / 16.0;
-                else // Interior
-                    cdata(I, J, K) =
-                    (fdata(i - 1, j - 1, k - 1) + fdata(i - 1, j - 1, k + 1) + fdata(i - 1, j + 1, k - 1) + fdata(i - 1, j + 1, k + 1) +
-                        fdata(i + 1, j - 1, k - 1) + fdata(i + 1, j - 1, k + 1) + fdata(i + 1, j + 1, k - 1) + fdata(i + 1, j + 1, k + 1)) / 64.0
-                    +
-                    (fdata(i, j - 1, k - 1) + fdata(i, j - 1, k + 1) + fdata(i, j + 1, k - 1) + fdata(i, j + 1, k + 1) +
-                        fdata(i - 1, j, k - 1) + fdata(i + 1, j, k - 1) + fdata(i - 1, j, k + 1) + fdata(i + 1, j, k + 1) +
-                        fdata(i - 1, j - 1, k) + fdata(i - 1, j + 1, k) + fdata(i + 1, j - 1, k) + fdata(i + 1, j + 1, k)) / 32.0
-                    +
-                    (fdata(i - 1, j, k) + fdata(i, j - 1, k) + fdata(i, j, k - 1) +
-                        fdata(i + 1, j, k) + fdata(i, j + 1, k) + fdata(i, j, k + 1)) / 16.0
-                    +
-                    fdata(i, j, k) / 8.0;
+                cdata(I, J, K) = RestrictNode(fdata, I, J, K, 0, lo, hi);
             });
         }
         FillBoundaryCoeff(crse_psi, m_geom[amrlev][mglev]);
@@ -878,6 +1128,91 @@ Elastic<SYM>::averageDownCoeffsSameAmrLevel(int amrlev)
     }
 }
 
+template<int SYM>
+void
+Elastic<SYM>::averageDownWeightsDifferentAmrLevels(int fine_amrlev)
+{
+    BL_PROFILE("Operator::Elastic::averageDownWeightsDifferentAmrLevels()");
+    Util::Assert(INFO, TEST(fine_amrlev > 0));
+
+    const int crse_amrlev = fine_amrlev - 1;
+
+    MultiFab& crse_w = *m_weight_mf[crse_amrlev][0];
+    MultiFab& fine_w = *m_weight_mf[fine_amrlev][0];
+    const int ncomp = crse_w.nComp();
+
+    amrex::Box cdomain(m_geom[crse_amrlev][0].Domain());
+    cdomain.convert(amrex::IntVect::TheNodeVector());
+
+    const Geometry& cgeom = m_geom[crse_amrlev][0];
+
+    const BoxArray& fba = fine_w.boxArray();
+    const DistributionMapping& fdm = fine_w.DistributionMap();
+
+    MultiFab fine_w_for_coarse(amrex::coarsen(fba, 2), fdm, ncomp, 2);
+    fine_w_for_coarse.ParallelCopy(crse_w, 0, 0, ncomp, 0, 0, cgeom.periodicity());
+
+    const int coarse_fine_node = 1;
+    const int fine_fine_node = 2;
+
+    amrex::iMultiFab nodemask(amrex::coarsen(fba, 2), fdm, 1, 2);
+    nodemask.ParallelCopy(*m_nd_fine_mask[crse_amrlev], 0, 0, 1, 0, 0, cgeom.periodicity());
+
+    for (MFIter mfi(fine_w_for_coarse, false); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+
+        amrex::Array4<const int> const& nmask = nodemask.array(mfi);
+        amrex::Array4<Set::Scalar> const& cdata = fine_w_for_coarse.array(mfi);
+        amrex::Array4<const Set::Scalar> const& fdata = fine_w.const_array(mfi);
+
+        const Dim3 lo = amrex::lbound(cdomain), hi = amrex::ubound(cdomain);
+
+        // I,J,K == coarse coordinates
+        amrex::ParallelFor(bx, ncomp, [=] AMREX_GPU_DEVICE(int I, int J, int K, int n) {
+            if (nmask(I, J, K) == fine_fine_node || nmask(I, J, K) == coarse_fine_node)
+                cdata(I, J, K, n) = RestrictNode(fdata, I, J, K, n, lo, hi);
+        });
+    }
+
+    crse_w.ParallelCopy(fine_w_for_coarse, 0, 0, ncomp, 0, 0, cgeom.periodicity());
+    Util::RealFillBoundary(crse_w, m_geom[crse_amrlev][0]);
+}
+
+template<int SYM>
+void
+Elastic<SYM>::averageDownWeightsSameAmrLevel(int amrlev, int mglev)
+{
+    BL_PROFILE("Elastic::averageDownWeightsSameAmrLevel()");
+
+    amrex::Box cdomain(m_geom[amrlev][mglev].Domain());
+    cdomain.convert(amrex::IntVect::TheNodeVector());
+
+    MultiFab& crse = *m_weight_mf[amrlev][mglev];
+    MultiFab& fine = *m_weight_mf[amrlev][mglev - 1];
+    const int ncomp = crse.nComp();
+
+    BoxArray newba = crse.boxArray();
+    newba.refine(2);
+    MultiFab fine_on_crseba(newba, crse.DistributionMap(), ncomp, 4);
+    fine_on_crseba.ParallelCopy(fine, 0, 0, ncomp, 2, 4, m_geom[amrlev][mglev].periodicity());
+
+    for (MFIter mfi(crse, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box bx = mfi.tilebox() & cdomain;
+
+        amrex::Array4<const Set::Scalar> const& fdata = fine_on_crseba.const_array(mfi);
+        amrex::Array4<Set::Scalar> const& cdata = crse.array(mfi);
+
+        const Dim3 lo = amrex::lbound(cdomain), hi = amrex::ubound(cdomain);
+
+        amrex::ParallelFor(bx, ncomp, [=] AMREX_GPU_DEVICE(int I, int J, int K, int n) {
+            cdata(I, J, K, n) = RestrictNode(fdata, I, J, K, n, lo, hi);
+        });
+    }
+    FillBoundaryCoeff(crse, m_geom[amrlev][mglev]);
+}
+
 template<int SYM>
 void
 Elastic<SYM>::FillBoundaryCoeff(MultiTab& sigma, const Geometry& geom)
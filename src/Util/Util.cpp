@@ -46,6 +46,10 @@ std::string GetFileName()
     }
     return filename;
 }
+void SetFileName(std::string a_filename)
+{
+    filename = a_filename;
+}
 void CopyFileToOutputDir(std::string a_path, bool fullpath)
 {
     if (filename == "")
@@ -109,7 +113,14 @@ void Initialize (int argc, char* argv[])
 {
     srand (time(NULL));
 
-    amrex::Initialize(argc, argv);
+    // amr.plot_async writes through AMReX's AsyncOut, which can only be
+    // switched on while AMReX is being initialized
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp_amr("amr"), pp_amrex("amrex");
+        int plot_async = 0;
+        pp_amr.query("plot_async", plot_async);
+        if (plot_async && !pp_amrex.contains("async_out")) pp_amrex.add("async_out", 1);
+    });
 
     IO::ParmParse pp_amrex("amrex");
     pp_amrex.add("throw_exception",1);
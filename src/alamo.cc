@@ -1,6 +1,9 @@
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <sstream>
+#include <map>
+#include <vector>
 
 #include "Util/Util.H"
 #include "IO/ParmParse.H"
@@ -21,14 +24,11 @@
 #include "Integrator/ThermoElastic.H"
 #include "Integrator/Dendrite.H"
 
-int main (int argc, char* argv[])
+// Construct the integrator selected by alamo.program
+Integrator::Integrator* NewIntegrator(IO::ParmParse& pp)
 {
-    Util::Initialize(argc,argv);
-
     std::string program = "microstructure";
-    IO::ParmParse pp;
     pp_query("alamo.program",program);
-    srand(2);
 
     Integrator::Integrator *integrator = nullptr;
     if (program == "microstructure")
@@ -45,8 +45,152 @@ int main (int argc, char* argv[])
     else if (program == "fracture")             integrator = new Integrator::Fracture();
     else if (program == "dendrite")             integrator = new Integrator::Dendrite(pp);
     else if (program == "allencahn")            integrator = new Integrator::AllenCahn(pp);
+    else if (program == "cahnhilliard")         integrator = new Integrator::CahnHilliard(pp);
     else Util::Abort(INFO,"Error: \"",program,"\" is not a valid program.");
+    return integrator;
+}
+
+//
+// Ensemble mode: run many small, independent simulations in one launch, so that
+// MPI and AMReX initialization and input parsing are paid once.
+// Members are listed in :code:`alamo.ensemble.file`, one per line:
+//
+//     [name] [key]=[value] [key]=[value] [value] ...
+//
+// Each member runs with the input file plus its overrides (values that are not
+// preceded by a key are appended to the previous one, for arrays), and
+// writes its output to [plot_file]/[name] unless it overrides plot_file itself.
+// All members run back to back on all ranks. Lines starting with # are ignored.
+//
+struct Member
+{
+    std::string name;
+    std::vector<std::string> keys;
+    std::map<std::string, std::vector<std::string>> values;
+};
+
+std::vector<Member> ReadEnsemble(std::string a_file)
+{
+    std::ifstream file(a_file);
+    if (!file.is_open()) Util::Abort(INFO,"Could not open ensemble file ",a_file);
+
+    std::vector<Member> members;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream tokens(line);
+        Member member;
+        if (!(tokens >> member.name) || member.name[0] == '#') continue;
+        for (const Member& other : members)
+            if (other.name == member.name) Util::Abort(INFO,"Duplicate ensemble member ",member.name);
+
+        std::string token;
+        while (tokens >> token)
+        {
+            std::size_t eq = token.find('=');
+            if (eq != std::string::npos)
+            {
+                std::string key = token.substr(0, eq);
+                if (!member.values.count(key)) member.keys.push_back(key);
+                member.values[key].clear();
+                if (eq + 1 < token.size()) member.values[key].push_back(token.substr(eq + 1));
+            }
+            else if (member.keys.empty()) Util::Abort(INFO,"Ensemble member ",member.name,": value ",token," has no key");
+            else member.values[member.keys.back()].push_back(token);
+        }
+        members.push_back(member);
+    }
+    return members;
+}
+
+// Replace the values of `a_member`'s keys in the global table, returning the previous ones
+std::map<std::string, std::vector<std::string>> ApplyOverrides(IO::ParmParse& pp, const Member& a_member)
+{
+    std::map<std::string, std::vector<std::string>> previous;
+    for (const std::string& key : a_member.keys)
+    {
+        const std::vector<std::string>& value = a_member.values.at(key);
+        if (value.empty()) Util::Abort(INFO,"Ensemble member ",a_member.name,": no value for ",key);
+        if (pp.contains(key.c_str())) pp.getarr(key.c_str(), previous[key]);
+        pp.remove(key);
+        pp.addarr(key.c_str(), value);
+    }
+    return previous;
+}
+
+void RestoreOverrides(IO::ParmParse& pp, const Member& a_member,
+                      const std::map<std::string, std::vector<std::string>>& a_previous)
+{
+    for (const std::string& key : a_member.keys)
+    {
+        pp.remove(key);
+        if (a_previous.count(key)) pp.addarr(key.c_str(), a_previous.at(key));
+    }
+}
+
+void RunEnsemble(IO::ParmParse& pp, std::string a_file)
+{
+    const std::vector<Member> members = ReadEnsemble(a_file);
+    const std::string base = Util::GetFileName();
+    if (base == "") Util::Abort(INFO,"Ensemble mode requires plot_file to be set");
+
+    std::ofstream summary;
+    if (amrex::ParallelDescriptor::IOProcessor())
+    {
+        summary.open(base + "/ensemble.dat");
+        summary << "member\toutput\twalltime" << std::endl;
+    }
+
+    for (unsigned int m = 0; m < members.size(); m++)
+    {
+        const Member& member = members[m];
+        Util::Message(INFO,"Ensemble member ",member.name," (",m + 1," of ",members.size(),")");
+
+        const std::map<std::string, std::vector<std::string>> previous = ApplyOverrides(pp, member);
+
+        std::string output = base + "/" + member.name;
+        if (member.values.count("plot_file"))
+        {
+            output = member.values.at("plot_file")[0];
+            IO::FileNameParse(output);
+        }
+        Util::CreateCleanDirectory(output, true);
+        Util::SetFileName(output);
+
+        srand(2);
+        const Set::Scalar start = amrex::second();
+        Integrator::Integrator *integrator = NewIntegrator(pp);
+        integrator->InitData();
+        integrator->Evolve();
+        delete integrator;
+        const Set::Scalar walltime = amrex::second() - start;
+
+        RestoreOverrides(pp, member, previous);
+
+        if (amrex::ParallelDescriptor::IOProcessor())
+            summary << member.name << "\t" << output << "\t" << walltime << std::endl;
+    }
+
+    Util::SetFileName(base);
+}
+
+int main (int argc, char* argv[])
+{
+    Util::Initialize(argc,argv);
+
+    IO::ParmParse pp;
+    std::string ensemble = "";
+    pp_query("alamo.ensemble.file",ensemble); // Run each member listed in this file (see above)
+    if (ensemble != "")
+    {
+        RunEnsemble(pp, ensemble);
+        Util::Finalize();
+        return 0;
+    }
+
+    srand(2);
 
+    Integrator::Integrator *integrator = NewIntegrator(pp);
     integrator->InitData();
     integrator->Evolve();
     delete integrator;
@@ -0,0 +1,74 @@
+//
+// Kernel-level microbenchmarks.
+//
+// Each kernel is run on a fixed problem and timed over a number of repetitions;
+// the results are written as JSON to :code:`benchmark.output` so that they can be
+// tracked from commit to commit.
+// See :code:`src/Benchmark/Suite.H` for the available options and the output format.
+//
+//     ./bin/benchmark-2d-g++ benchmark.reps=20 benchmark.output=bench-2d.json
+//
+
+#include "Util/Util.H"
+#include "IO/ParmParse.H"
+
+#include "Benchmark/Suite.H"
+#include "Benchmark/Set/Matrix4.H"
+#include "Benchmark/Set/SoA.H"
+#include "Benchmark/Numeric/Stencil.H"
+#include "Benchmark/Operator/Elastic.H"
+#include "Benchmark/Integrator/PhaseFieldMicrostructure.H"
+#include "Benchmark/IC/Voronoi.H"
+
+int main (int argc, char* argv[])
+{
+    Util::Initialize(argc, argv);
+    srand(2);
+
+    Benchmark::Suite suite;
+    {
+        IO::ParmParse pp("benchmark");
+        pp_queryclass(suite);
+    }
+
+    Util::Test::Message("Set::Matrix4 contraction");
+    {
+        Benchmark::Set::Matrix4<Set::Sym::Major>().Run(suite, "Major");
+        Benchmark::Set::Matrix4<Set::Sym::MajorMinor>().Run(suite, "MajorMinor");
+        Benchmark::Set::Matrix4<Set::Sym::Diagonal>().Run(suite, "Diagonal");
+        Benchmark::Set::Matrix4<Set::Sym::Isotropic>().Run(suite, "Isotropic");
+    }
+
+    Util::Test::Message("Set::SoAPatch");
+    {
+        Benchmark::Set::SoA().Run(suite);
+    }
+
+    Util::Test::Message("Numeric::Stencil");
+    {
+        Benchmark::Numeric::Stencil().Run(suite);
+    }
+
+    Util::Test::Message("Operator::Elastic");
+    {
+        Benchmark::Operator::Elastic<Set::Sym::Isotropic>().Run(suite, "Isotropic",
+            Set::Matrix4<AMREX_SPACEDIM,Set::Sym::Isotropic>(1.0, 1.0));
+        Benchmark::Operator::Elastic<Set::Sym::MajorMinor>().Run(suite, "MajorMinor",
+            Set::Matrix4<AMREX_SPACEDIM,Set::Sym::MajorMinor>::Cubic(1.68, 1.21, 0.75));
+    }
+
+    Util::Test::Message("IC::Voronoi");
+    {
+        Benchmark::IC::Voronoi().Run(suite, 100, 10);
+    }
+
+    Util::Test::Message("Integrator::PhaseFieldMicrostructure");
+    {
+        Benchmark::Integrator::PhaseFieldMicrostructure().Run(suite);
+    }
+
+    suite.Write();
+
+    Util::Finalize();
+    return 0;
+}
@@ -4,6 +4,9 @@
 
 #include "Test/Numeric/Stencil.H"
 #include "Test/Set/Matrix4.H"
+#include "Test/Model/Interface/GB/GB.H"
+#include "Test/Model/Solid/Linear/Isotropic.H"
+#include "Test/Util/ErrorFlag.H"
 
 #include "Operator/Elastic.H"
 
@@ -21,6 +24,8 @@
 #include "Model/Solid/Finite/PseudoLinearCubicPredeformed.H"
 #include "Model/Solid/Linear/Hexagonal.H"
 #include "Model/Solid/Affine/Hexagonal.H"
+#include "Model/Interface/GB/Sin.H"
+#include "Model/Interface/GB/SH.H"
 
 int main (int argc, char* argv[])
 {
@@ -52,6 +57,14 @@ int main (int argc, char* argv[])
     MODELTEST(Model::Solid::Finite::PseudoLinearCubic);
     MODELTEST(Model::Solid::Finite::NeoHookeanPredeformed);
     MODELTEST(Model::Solid::Finite::PseudoLinearCubicPredeformed);
+
+    Util::Test::Message("Model::Solid::Linear::Isotropic degradation");
+    {
+        int subfailed = 0;
+        Test::Model::Solid::Linear::Isotropic test;
+        subfailed += Util::Test::SubMessage("Scaling", test.DegradationTest(0));
+        failed += Util::Test::SubFinalMessage(subfailed);
+    }
     
 
     Util::Test::Message("Set::Matrix4");
@@ -65,6 +78,21 @@ int main (int argc, char* argv[])
         subfailed += Util::Test::SubMessage("3D - MajorMinor", test_3d_majorminor.SymmetryTest(0));
     }
 
+    Util::Test::Message("Model::Interface::GB tabulation");
+    {
+        int subfailed = 0;
+#if AMREX_SPACEDIM == 2
+        Test::Model::Interface::GB::GB<Model::Interface::GB::Sin> test_sin;
+        subfailed += Util::Test::SubMessage("Sin", test_sin.TabulationTest(0));
+        subfailed += Util::Test::SubMessage("Sin device table", test_sin.DeviceTableTest(0));
+#elif AMREX_SPACEDIM == 3
+        Test::Model::Interface::GB::GB<Model::Interface::GB::SH> test_sh;
+        subfailed += Util::Test::SubMessage("SH", test_sh.TabulationTest(0));
+        subfailed += Util::Test::SubMessage("SH device table", test_sh.DeviceTableTest(0));
+#endif
+        failed += Util::Test::SubFinalMessage(subfailed);
+    }
+
     Util::Test::Message("Numeric::Interpolator<Linear>");
     {
         int subfailed = 0;
@@ -111,6 +139,15 @@ int main (int argc, char* argv[])
         subfailed += Util::Test::SubMessage("1-2-1",test.Derivative<1,2,1>(0));
         subfailed += Util::Test::SubMessage("1-1-2",test.Derivative<1,1,2>(0));
 #endif
+        subfailed += Util::Test::SubMessage("Neighborhood",test.Neighborhood(0));
+        failed += Util::Test::SubFinalMessage(subfailed);
+    }
+
+    Util::Test::Message("Util::ErrorFlag");
+    {
+        int subfailed = 0;
+        Test::Util::ErrorFlag test;
+        subfailed += Util::Test::SubMessage("Raise", test.RaiseTest(0));
         failed += Util::Test::SubFinalMessage(subfailed);
     }
 